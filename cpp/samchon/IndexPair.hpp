@@ -81,7 +81,7 @@ namespace samchon
 		 */
 		auto get_index() const -> size_t
 		{
-			return first;
+			return this->first;
 		};
 
 		/**
@@ -91,7 +91,7 @@ namespace samchon
 		 */
 		auto getValue() -> T&
 		{
-			return second;
+			return this->second;
 		};
 
 		/**
@@ -101,7 +101,7 @@ namespace samchon
 		 */
 		auto getValue() const -> const T&
 		{
-			return second;
+			return this->second;
 		};
 	};
 };
\ No newline at end of file
@@ -59,6 +59,14 @@ namespace interaction
 			getSystemArray<base::MasterBase>()->getMonitor()->reportSendData(getUID(), invoke);
 		};
 
+		virtual void sendFrame(std::shared_ptr<const protocol::InvokeFrame> frame) override
+		{
+			super::sendFrame(frame);
+
+			// NOTIFY SEND_DATA
+			getSystemArray<base::MasterBase>()->getMonitor()->reportSendData(getUID(), frame->getInvoke());
+		};
+
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
 			if (invoke->getListener() == "construct")
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <samchon/templates/parallel/WeightedPartitioner.hpp>
+#include <samchon/templates/parallel/OverDecomposedPartitioner.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace partitioner
+{
+	using namespace std;
+	using namespace samchon::templates::parallel;
+
+	/**
+	 * Validate pieces of a partition.
+	 *
+	 * Every index in [first, last) must be covered by exactly one piece and each piece must be allocated to one of
+	 * the systems. Throws a logic_error, describing the trial, otherwise.
+	 */
+	void validate(const vector<IndexPair<pair<size_t, size_t>>> &pieces, size_t systems, size_t first, size_t last, const string &trial)
+	{
+		vector<size_t> coverage(last - first, 0);
+
+		for (size_t i = 0; i < pieces.size(); i++)
+		{
+			size_t index = pieces[i].first;
+			size_t my_first = pieces[i].second.first;
+			size_t my_last = pieces[i].second.second;
+
+			if (index >= systems)
+				throw logic_error(trial + ": a piece is allocated to a system not exist.");
+			else if (my_first >= my_last || my_first < first || my_last > last)
+				throw logic_error(trial + ": a piece is empty or out of the range.");
+
+			for (size_t j = my_first; j < my_last; j++)
+				coverage[j - first]++;
+		}
+
+		for (size_t j = 0; j < coverage.size(); j++)
+			if (coverage[j] != 1)
+				throw logic_error(trial + ": index " + to_string(first + j) + " is covered " + to_string(coverage[j]) + " times.");
+	};
+
+	/**
+	 * Cost models of the systems; confident ones if *confident*, otherwise empty ones.
+	 */
+	auto make_models(mt19937 &random, size_t systems, bool confident) -> vector<CostModel>
+	{
+		vector<CostModel> models(systems);
+		if (confident == false)
+			return models;
+
+		uniform_real_distribution<double> overhead(0.0, 50.0);
+		uniform_real_distribution<double> rate(.1, 10.0);
+
+		for (size_t i = 0; i < systems; i++)
+		{
+			double my_overhead = overhead(random);
+			double my_rate = rate(random);
+
+			for (size_t size = 10; size <= 1000; size *= 10)
+				for (size_t k = 0; k < 10; k++)
+					models[i].observe((double)size, my_overhead + size / my_rate);
+		}
+		return models;
+	};
+
+	/**
+	 * Self-checking test of the partitioners.
+	 *
+	 * Partitions random ranges by random performance indices, including zero and equal ones, with and without
+	 * confident cost models, by the {@link WeightedPartitioner} and the {@link OverDecomposedPartitioner}. Every
+	 * partition must cover its range exactly once.
+	 */
+	void main()
+	{
+		mt19937 random(1225);
+		uniform_int_distribution<size_t> system_count(1, 16);
+		uniform_int_distribution<size_t> bound(0, 5000);
+		uniform_int_distribution<size_t> k(1, 8);
+		uniform_int_distribution<int> kind(0, 3);
+		uniform_real_distribution<double> performance(0.0, 10.0);
+
+		size_t trials = 0;
+		for (size_t t = 0; t < 2000; t++)
+		{
+			// SYSTEMS WITH RANDOM, ZERO OR EQUAL PERFORMANCE INDICES
+			size_t systems = system_count(random);
+			vector<double> performances(systems);
+
+			int my_kind = kind(random);
+			for (size_t i = 0; i < systems; i++)
+				if (my_kind == 0)
+					performances[i] = 1.0;
+				else if (my_kind == 1)
+					performances[i] = 0.0;
+				else
+					performances[i] = performance(random);
+
+			// RANGE, INCLUDING THE EMPTY ONE AND ONE SMALLER THAN NUMBER OF THE SYSTEMS
+			size_t first = bound(random);
+			size_t last = first + ((t % 10 == 0) ? t % systems : bound(random));
+
+			vector<CostModel> models = make_models(random, systems, t % 2 == 1);
+			string trial = "trial #" + to_string(t) + " [" + to_string(first) + ", " + to_string(last) + ") by " + to_string(systems) + " systems";
+
+			WeightedPartitioner weighted;
+			validate(weighted.partition(performances, models, first, last), systems, first, last, trial + ", weighted");
+
+			OverDecomposedPartitioner over_decomposed(k(random));
+			validate(over_decomposed.partition(performances, models, first, last), systems, first, last, trial + ", over-decomposed by " + to_string(over_decomposed.getK()));
+
+			trials++;
+		}
+
+		cout << "Partitioners have covered every index exactly once, in " << trials << " trials." << endl;
+	};
+};
+};
+};
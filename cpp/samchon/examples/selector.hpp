@@ -0,0 +1,238 @@
+#pragma once
+
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <samchon/templates/distributed/DistributedSystemArray.hpp>
+#include <samchon/templates/distributed/LeastWorkSelector.hpp>
+#include <samchon/templates/distributed/PowerOfTwoSelector.hpp>
+#include <samchon/templates/distributed/WeightedQueueSelector.hpp>
+#include <samchon/templates/simulation.hpp>
+
+namespace samchon
+{
+namespace examples
+{
+namespace selector
+{
+	using namespace std;
+	using namespace samchon::protocol;
+	using namespace samchon::templates::distributed;
+	using namespace samchon::templates::simulation;
+
+	/**
+	 * A process requested to the simulated systems.
+	 */
+	class TaskProcess
+		: public DistributedProcess
+	{
+	public:
+		TaskProcess(base::DistributedSystemArrayBase *systemArray)
+			: DistributedProcess(systemArray)
+		{
+			this->name = "task";
+		};
+
+		virtual void replyData(shared_ptr<Invoke>) override
+		{
+		};
+	};
+
+	/**
+	 * A master having only the {@link TaskProcess}.
+	 */
+	class Master
+		: public DistributedSystemArray<DistributedSystem>
+	{
+	public:
+		Master()
+			: DistributedSystemArray<DistributedSystem>()
+		{
+			insertProcess(make_shared<TaskProcess>(this));
+		};
+
+		virtual void replyData(shared_ptr<Invoke>) override
+		{
+		};
+
+	protected:
+		virtual auto createChild(shared_ptr<library::XML>) -> DistributedSystem* override
+		{
+			return nullptr;
+		};
+		virtual auto createProcess(shared_ptr<library::XML>) -> DistributedProcess* override
+		{
+			return nullptr;
+		};
+	};
+
+	/**
+	 * Choices of a selector; number of processes and sum of their weights, by names of the systems.
+	 */
+	struct Choices
+	{
+		map<string, size_t> counts;
+		map<string, double> weights;
+		shared_ptr<SimulationReport> report;
+	};
+
+	/**
+	 * Profiles of the systems; speeds are 4:2:1:1.
+	 */
+	auto make_profiles() -> vector<SystemProfile>
+	{
+		vector<SystemProfile> profiles =
+		{
+			SystemProfile("fast", 400.0),
+			SystemProfile("middle", 200.0),
+			SystemProfile("slow-1", 100.0),
+			SystemProfile("slow-2", 100.0)
+		};
+		return profiles;
+	};
+
+	/**
+	 * Simulate a burst of processes, having weights 1 and 3 by turns, chosen by the *selector*.
+	 *
+	 * Performance indices are enforced to speeds of the profiles, thus the selector knows the systems from the start.
+	 * All the processes are sent at once, before any report, thus the choices depend only on the load counters.
+	 */
+	auto simulate(shared_ptr<SystemSelector> selector, size_t processes) -> Choices
+	{
+		Choices choices;
+		vector<SystemProfile> profiles = make_profiles();
+
+		Simulator<Master> simulator(7);
+		for (size_t i = 0; i < profiles.size(); i++)
+			simulator.insert(profiles[i]);
+
+		simulator.post(0.0, [&](Master &master)
+		{
+			master.setSelector(selector);
+			for (size_t i = 0; i < master.size(); i++)
+				for (size_t j = 0; j < profiles.size(); j++)
+					if (master.at(i)->getName() == profiles[j].getName())
+						master.at(i)->enforcePerformance(profiles[j].getSpeed());
+
+			shared_ptr<DistributedProcess> process = master.getProcess("task");
+			for (size_t i = 0; i < processes; i++)
+			{
+				double weight = (i % 2 == 0) ? 1.0 : 3.0;
+				shared_ptr<DistributedSystem> system = process->sendData(make_shared<Invoke>("compute"), weight);
+
+				if (system == nullptr)
+					throw logic_error("No system has been selected.");
+
+				choices.counts[system->getName()]++;
+				choices.weights[system->getName()] += weight;
+			}
+		});
+		choices.report = simulator.run();
+
+		return choices;
+	};
+
+	/**
+	 * Validate that all the processes have been completed, within the *tolerance* times of the ideal makespan.
+	 */
+	void validate_report(const Choices &choices, size_t processes, double tolerance, const string &trial)
+	{
+		vector<SystemProfile> profiles = make_profiles();
+		double speed = 0.0;
+		for (size_t i = 0; i < profiles.size(); i++)
+			speed += profiles[i].getSpeed();
+
+		size_t completed = 0;
+		for (size_t i = 0; i < choices.report->size(); i++)
+			completed += choices.report->at(i)->getProcesses();
+
+		if (completed != processes)
+			throw logic_error(trial + ": " + to_string(completed) + " processes are completed, of " + to_string(processes) + ".");
+
+		double ideal = (processes / 2) * 4.0 / speed;
+		if (choices.report->getMakespan() > ideal * tolerance)
+			throw logic_error(trial + ": makespan " + to_string(choices.report->getMakespan()) + " is over " + to_string(tolerance) + " times of the ideal " + to_string(ideal) + ".");
+	};
+
+	/**
+	 * Validate that the *values* chosen are proportional to the speeds, within the *error*.
+	 */
+	void validate_share(const map<string, double> &values, double error, const string &trial)
+	{
+		vector<SystemProfile> profiles = make_profiles();
+		double speed = 0.0;
+		double sum = 0.0;
+
+		for (size_t i = 0; i < profiles.size(); i++)
+			speed += profiles[i].getSpeed();
+		for (auto it = values.begin(); it != values.end(); it++)
+			sum += it->second;
+
+		for (size_t i = 0; i < profiles.size(); i++)
+		{
+			auto it = values.find(profiles[i].getName());
+			double value = (it == values.end()) ? 0.0 : it->second;
+			double expected = sum * profiles[i].getSpeed() / speed;
+
+			if (abs(value - expected) > error)
+				throw logic_error(trial + ": " + profiles[i].getName() + " has got " + to_string(value) + ", expected " + to_string(expected) + ".");
+		}
+	};
+
+	auto to_doubles(const map<string, size_t> &counts) -> map<string, double>
+	{
+		map<string, double> values;
+		for (auto it = counts.begin(); it != counts.end(); it++)
+			values[it->first] = (double)it->second;
+
+		return values;
+	};
+
+	/**
+	 * Self-checking test of the selectors, by the {@link Simulator}.
+	 *
+	 * Four systems of speeds 4:2:1:1 get a burst of processes weighted 1 and 3 by turns.
+	 *
+	 * - {@link LeastWorkSelector}: sums of weights are proportional to the speeds, within the maximum weight. The
+	 *	 makespan is within 5% of the ideal one.
+	 * - {@link WeightedQueueSelector}: numbers of processes are proportional to the speeds, within one. Weights are
+	 *	 not considered, thus the makespan may be 1.5 times of the ideal one; a slow system gets the heavy ones.
+	 * - {@link PowerOfTwoSelector}: a faster system gets more processes than a slower one, and sums of weights are
+	 *	 proportional to the speeds, within 2.5% of the total. The makespan is within 10% of the ideal one.
+	 *
+	 * Every process must be completed.
+	 */
+	void main()
+	{
+		const size_t PROCESSES = 800;
+
+		// LEAST WORK; BALANCES WEIGHTS
+		Choices least_work = simulate(make_shared<LeastWorkSelector>(), PROCESSES);
+		validate_share(least_work.weights, 3.0, "least-work");
+		validate_report(least_work, PROCESSES, 1.05, "least-work");
+
+		// WEIGHTED QUEUE; BALANCES NUMBERS OF THE PROCESSES, NOT THEIR WEIGHTS
+		Choices weighted_queue = simulate(make_shared<WeightedQueueSelector>(), PROCESSES);
+		validate_share(to_doubles(weighted_queue.counts), 1.0, "weighted-queue");
+		validate_report(weighted_queue, PROCESSES, 1.55, "weighted-queue");
+
+		// POWER OF TWO; RANDOM, BUT SEEDED
+		Choices power_of_two = simulate(make_shared<PowerOfTwoSelector>(1225), PROCESSES);
+		if (!(power_of_two.counts["fast"] > power_of_two.counts["middle"]
+			&& power_of_two.counts["middle"] > power_of_two.counts["slow-1"]
+			&& power_of_two.counts["middle"] > power_of_two.counts["slow-2"]))
+			throw logic_error("power-of-two: a slower system has got more processes than a faster one.");
+		validate_share(power_of_two.weights, 40.0, "power-of-two");
+		validate_report(power_of_two, PROCESSES, 1.1, "power-of-two");
+
+		cout << "Selectors have chosen the systems by their profiles." << endl;
+		for (auto it = least_work.counts.begin(); it != least_work.counts.end(); it++)
+			cout << "\t" << it->first << ": "
+				<< "least-work " << it->second << " (" << least_work.weights[it->first] << "), "
+				<< "weighted-queue " << weighted_queue.counts[it->first] << " (" << weighted_queue.weights[it->first] << "), "
+				<< "power-of-two " << power_of_two.counts[it->first] << " (" << power_of_two.weights[it->first] << ")" << endl;
+	};
+};
+};
+};
\ No newline at end of file
@@ -38,4 +38,7 @@
 #include <samchon/library/CaseGenerator.hpp>
 #include <samchon/library/CombinedPermutationGenerator.hpp>
 #include <samchon/library/PermutationGenerator.hpp>
-#include <samchon/library/FactorialGenerator.hpp>
\ No newline at end of file
+#include <samchon/library/FactorialGenerator.hpp>
+
+// THREAD
+#include <samchon/library/ThreadPool.hpp>
\ No newline at end of file
@@ -0,0 +1,236 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <deque>
+#include <map>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+namespace samchon
+{
+namespace library
+{
+	/**
+	 * A pool of persistent threads.
+	 *
+	 * The {@link ThreadPool} executes tasks {@link post posted} to it by its persistent threads, instead of creating a
+	 * thread for each task. The threads are created lazily, when the first task is posted. With only one thread, the
+	 * tasks are executed in order of posting.
+	 *
+	 * A task can also be {@link schedule scheduled} to be executed after a delay. The threads wait until the earliest
+	 * scheduled time, without occupying a thread for each delayed task.
+	 *
+	 * Exceptions thrown from tasks are ignored.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class ThreadPool
+	{
+	private:
+		std::deque<std::function<void()>> queue_;
+		std::multimap<std::chrono::steady_clock::time_point, std::function<void()>> timers_;
+		std::vector<std::thread> threads_;
+		size_t size_;
+
+		std::mutex mtx_;
+		std::condition_variable cv_;
+		bool stopped_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from number of threads.
+		 *
+		 * @param size Number of threads to execute tasks.
+		 */
+		ThreadPool(size_t size = 1)
+		{
+			size_ = std::max<size_t>(size, 1);
+			stopped_ = false;
+		};
+
+		/**
+		 * Destructor, stopping the threads.
+		 */
+		virtual ~ThreadPool()
+		{
+			stop();
+		};
+
+		/**
+		 * Change number of threads.
+		 *
+		 * The threads are created lazily, when the first task is posted. After that, number of threads can only grow.
+		 *
+		 * @param size Number of threads to execute tasks.
+		 */
+		void reserve(size_t size)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			size_ = std::max<size_t>(std::max<size_t>(size, 1), threads_.size());
+
+			// GROW THE STARTED THREADS
+			if (threads_.empty() == false && stopped_ == false)
+				start();
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get number of threads.
+		 */
+		auto size() const -> size_t
+		{
+			return size_;
+		};
+
+		/**
+		 * Get number of tasks waiting for execution.
+		 */
+		auto pending() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return queue_.size();
+		};
+
+		/* ---------------------------------------------------------
+			EXECUTION
+		--------------------------------------------------------- */
+		/**
+		 * Post a task.
+		 *
+		 * Enqueues the *task* and returns immediately. If the pool has been {@link stop stopped}, the *task* is discarded.
+		 *
+		 * @param task A task to execute.
+		 * @return Whether the *task* is enqueued.
+		 */
+		auto post(std::function<void()> task) -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			if (stopped_ == true)
+				return false;
+
+			queue_.push_back(move(task));
+
+			// START THREADS LAZILY
+			if (threads_.empty() == true)
+				start();
+			else
+				cv_.notify_one();
+
+			return true;
+		};
+
+		/**
+		 * Schedule a task.
+		 *
+		 * Enqueues the *task* to be executed after the *delay* and returns immediately. If the pool has been 
+		 * {@link stop stopped}, the *task* is discarded.
+		 *
+		 * @param delay Delay until the execution.
+		 * @param task A task to execute.
+		 * @return Whether the *task* is enqueued.
+		 */
+		auto schedule(std::chrono::steady_clock::duration delay, std::function<void()> task) -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			if (stopped_ == true)
+				return false;
+
+			timers_.emplace(std::chrono::steady_clock::now() + delay, move(task));
+
+			// THE EARLIEST TIME MAY HAVE CHANGED
+			if (threads_.empty() == true)
+				start();
+			else
+				cv_.notify_all();
+
+			return true;
+		};
+
+		/**
+		 * Stop the threads.
+		 *
+		 * Waits for the tasks on execution to complete. Tasks waiting for execution are discarded and tasks posted
+		 * after the stop are not accepted.
+		 */
+		void stop()
+		{
+			std::vector<std::thread> threads;
+			{
+				std::unique_lock<std::mutex> uk(mtx_);
+
+				stopped_ = true;
+				queue_.clear();
+				timers_.clear();
+				threads = move(threads_);
+			}
+			cv_.notify_all();
+
+			for (size_t i = 0; i < threads.size(); i++)
+				if (threads[i].get_id() == std::this_thread::get_id())
+					threads[i].detach(); // STOPPED BY A TASK
+				else
+					threads[i].join();
+		};
+
+	private:
+		void start()
+		{
+			while (threads_.size() < size_)
+				threads_.emplace_back(&ThreadPool::execute, this);
+		};
+
+		void execute()
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			while (true)
+			{
+				if (stopped_ == true)
+					break;
+
+				// MIGRATE THE DUE TIMERS
+				std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+				while (timers_.empty() == false && timers_.begin()->first <= now)
+				{
+					queue_.push_back(move(timers_.begin()->second));
+					timers_.erase(timers_.begin());
+				}
+
+				if (queue_.empty() == true)
+				{
+					// WAIT FOR A TASK OR THE EARLIEST TIMER
+					if (timers_.empty() == true)
+						cv_.wait(uk);
+					else
+					{
+						std::chrono::steady_clock::time_point until = timers_.begin()->first;
+						cv_.wait_until(uk, until);
+					}
+					continue;
+				}
+
+				std::function<void()> task = move(queue_.front());
+				queue_.pop_front();
+
+				uk.unlock();
+				try
+				{
+					task();
+				}
+				catch (...) {}
+				uk.lock();
+			}
+		};
+	};
+};
+};
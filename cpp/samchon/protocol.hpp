@@ -4,6 +4,7 @@
 	BASIC COMPONENTS
 ------------------------------------------------------------- */
 #include <samchon/protocol/Invoke.hpp>
+#include <samchon/protocol/InvokeFrame.hpp>
 #include <samchon/protocol/IProtocol.hpp>
 #include <samchon/protocol/IListener.hpp>
 
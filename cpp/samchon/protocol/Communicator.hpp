@@ -3,11 +3,16 @@
 
 #include <samchon/protocol/IProtocol.hpp>
 #include <samchon/protocol/IListener.hpp>
+#include <samchon/protocol/InvokeFrame.hpp>
 
 #include <iostream>
 #include <array>
+#include <deque>
 #include <exception>
+#include <stdexcept>
 #include <mutex>
+#include <thread>
+#include <condition_variable>
 #include <boost/asio.hpp>
 #include <samchon/ByteArray.hpp>
 
@@ -46,13 +51,36 @@ namespace protocol
 
 		std::mutex send_mtx;
 
+	private:
+		// STATE OF THE ASYNCHRONOUS WRITER, SHARED WITH ITS THREAD; THE THREAD DOES NOT TOUCH A COMMUNICATOR 
+		// DESTRUCTED WHILE WRITING ON IT
+		struct Writer
+		{
+			std::deque<std::shared_ptr<const InvokeFrame>> queue;
+			std::mutex mtx;
+			std::condition_variable cv;
+			std::condition_variable written_cv;
+
+			size_t posted{ 0 };
+			size_t written{ 0 };
+			std::exception_ptr error;
+
+			std::thread thread;
+			bool writing{ false };
+			bool stopped{ false };
+			bool destructed{ false };
+		};
+		std::shared_ptr<Writer> writer_;
+
 	public:
 		Communicator()
 		{
 			listener = nullptr;
+			writer_.reset(new Writer());
 		};
 		virtual ~Communicator()
 		{
+			_Stop_writer();
 			close();
 		};
 
@@ -90,16 +118,197 @@ namespace protocol
 		* @param invoke An {@link Invoke} message to send.
 		*/
 		virtual void sendData(std::shared_ptr<Invoke> invoke)
+		{
+			sendFrame(std::make_shared<InvokeFrame>(invoke));
+		};
+
+		/**
+		 * Send a serialized message.
+		 *
+		 * Sends an {@link InvokeFrame}, an {@link Invoke} message serialized in advance, to remote system. Sending a 
+		 * same {@link InvokeFrame} to multiple remote systems, serialization cost is paid only once.
+		 *
+		 * The frame goes through the asynchronous writer, after the frames {@link postFrame posted} ahead, and this 
+		 * method returns when it has been written. Thus a message sent never overtakes the ones posted before.
+		 *
+		 * @param frame A serialized {@link Invoke} message to send.
+		 * @throw std::exception An I/O error of the writer, if the connection has been broken.
+		 */
+		virtual void sendFrame(std::shared_ptr<const InvokeFrame> frame)
+		{
+			std::shared_ptr<Writer> writer = writer_;
+			std::unique_lock<std::mutex> uk(writer->mtx);
+
+			if (writer->thread.get_id() == std::this_thread::get_id())
+			{
+				// CALLED BY THE WRITER ITSELF
+				uk.unlock();
+				_Write_frame(frame);
+				return;
+			}
+			else if (writer->error != nullptr)
+				std::rethrow_exception(writer->error);
+			else if (writer->stopped == true)
+				throw std::logic_error("The communicator has stopped.");
+
+			size_t sequence = _Enqueue(frame);
+			writer->written_cv.wait(uk, [writer, sequence]() -> bool
+			{
+				return writer->written >= sequence || writer->error != nullptr;
+			});
+
+			if (writer->written < sequence)
+				std::rethrow_exception(writer->error);
+		};
+
+		/**
+		 * Post a serialized message.
+		 *
+		 * Enqueues an {@link InvokeFrame} to the asynchronous writer and returns immediately, without waiting for the
+		 * socket I/O. The writer is a persistent thread owned by this {@link Communicator}, created at the first 
+		 * posting. Posted frames are sent in order.
+		 *
+		 * If the writer has failed by an I/O error, the frame is discarded; the writer has closed the connection, 
+		 * thus the listener is notified by the disconnection.
+		 *
+		 * @param frame A serialized {@link Invoke} message to send.
+		 */
+		void postFrame(std::shared_ptr<const InvokeFrame> frame)
+		{
+			std::unique_lock<std::mutex> uk(writer_->mtx);
+			if (writer_->stopped == true || writer_->error != nullptr)
+				return;
+
+			_Enqueue(frame);
+		};
+
+	protected:
+		/**
+		 * Stop the asynchronous writer.
+		 *
+		 * Frames remained in the queue are flushed before the termination. Derived classes overriding 
+		 * {@link _Write_frame _Write_frame()} must call it in their destructors.
+		 */
+		void _Stop_writer()
+		{
+			std::shared_ptr<Writer> writer = writer_;
+			{
+				std::unique_lock<std::mutex> uk(writer->mtx);
+				if (writer->stopped == true)
+					return;
+
+				writer->stopped = true;
+			}
+			writer->cv.notify_all();
+
+			if (writer->thread.joinable() == false)
+				return;
+			else if (writer->thread.get_id() == std::this_thread::get_id())
+			{
+				// DESTRUCTED ON THE WRITER; IT ENDS WITHOUT TOUCHING THIS OBJECT AGAIN
+				std::unique_lock<std::mutex> uk(writer->mtx);
+				writer->destructed = true;
+				writer->queue.clear();
+
+				writer->thread.detach();
+			}
+			else
+				writer->thread.join();
+		};
+
+		/**
+		 * Write a serialized message to the socket.
+		 *
+		 * Called by the asynchronous writer, one frame at a time.
+		 *
+		 * @param frame A serialized {@link Invoke} message to write.
+		 */
+		virtual void _Write_frame(std::shared_ptr<const InvokeFrame> frame)
 		{
 			std::unique_lock<std::mutex> uk(send_mtx);
 
 			// SEND INVOKE
-			send_data(invoke->toXML()->toString());
+			send_frame_string(*frame);
 
 			// SEND BINARY
-			for (size_t i = 0; i < invoke->size(); i++)
-				if (invoke->at(i)->getType() == "ByteArray")
-					send_data(invoke->at(i)->referValue<ByteArray>());
+			for (size_t i = 0; i < frame->getBinaries().size(); i++)
+				send_data(frame->getBinaries()[i]->referValue<ByteArray>());
+		};
+
+	private:
+		auto _Enqueue(std::shared_ptr<const InvokeFrame> frame) -> size_t
+		{
+			writer_->queue.push_back(frame);
+			size_t sequence = ++writer_->posted;
+
+			if (writer_->writing == false)
+			{
+				// START THE WRITER
+				writer_->writing = true;
+				writer_->thread = std::thread(&Communicator::write_frames, this, writer_);
+			}
+			else
+				writer_->cv.notify_one();
+
+			return sequence;
+		};
+
+		void write_frames(std::shared_ptr<Writer> writer)
+		{
+			std::unique_lock<std::mutex> uk(writer->mtx);
+
+			while (true)
+			{
+				writer->cv.wait(uk, [&writer]() -> bool
+				{
+					return writer->queue.empty() == false || writer->stopped == true;
+				});
+				if (writer->queue.empty() == true)
+					break; // STOPPED AND NOTHING TO FLUSH
+
+				std::shared_ptr<const InvokeFrame> frame = writer->queue.front();
+				writer->queue.pop_front();
+
+				uk.unlock();
+				try
+				{
+					_Write_frame(frame);
+				}
+				catch (...)
+				{
+					uk.lock();
+					if (writer->destructed == true)
+						break;
+
+					// REPORT TO THE SENDERS AND CLOSE THE CONNECTION; THE LISTENER IS NOTIFIED BY THE DISCONNECTION,
+					// THEN WORKS OF THE FRAMES LEFT ARE SENT BACK BY ITS OWNER
+					writer->error = std::current_exception();
+					writer->queue.clear();
+					writer->written_cv.notify_all();
+
+					try
+					{
+						std::rethrow_exception(writer->error);
+					}
+					catch (std::exception &e)
+					{
+						std::cout << "Reason of disconnection: " << e.what() << std::endl;
+					}
+					catch (...)
+					{
+					}
+					close();
+					break;
+				}
+				uk.lock();
+
+				if (writer->destructed == true)
+					break;
+
+				writer->written++;
+				writer->written_cv.notify_all();
+			}
+			writer->writing = false;
 		};
 
 	protected:
@@ -231,6 +440,19 @@ namespace protocol
 			socket->write_some(boost::asio::buffer(header));
 			socket->write_some(boost::asio::buffer(data));
 		};
+
+		void send_frame_string(const InvokeFrame &frame)
+		{
+			ByteArray header;
+			header.writeReversely((unsigned long long)frame.size());
+
+			// HEAD IS SHARED WITH OTHER FRAMES, THUS WRITE IT WITHOUT CONCATENATION
+			WeakString head = frame.getHead();
+
+			boost::asio::write(*socket, boost::asio::buffer(header));
+			boost::asio::write(*socket, boost::asio::buffer(head.data(), head.size()));
+			boost::asio::write(*socket, boost::asio::buffer(frame.getTail()));
+		};
 	};
 };
 };
\ No newline at end of file
@@ -0,0 +1,189 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/Invoke.hpp>
+
+#include <vector>
+#include <samchon/WeakString.hpp>
+
+namespace samchon
+{
+namespace protocol
+{
+	/**
+	 * A serialized {@link Invoke} message.
+	 *
+	 * The {@link InvokeFrame} is an immutable, pre-serialized form of an {@link Invoke} message. Serializing an
+	 * {@link Invoke} message ({@link Invoke.toXML} and {@link XML.toString}) is not cheap. When a same {@link Invoke}
+	 * message is delivered to many remote systems, like a broadcast of {@link ExternalSystemArray.sendData}, serialize
+	 * it only once into an {@link InvokeFrame} and share the frame with all the {@link Communicator communicators}.
+	 *
+	 * #### Shared prefix
+	 * A frame is composed of a *head* and a *tail*. The *head* is the serialized {@link Invoke} message without its
+	 * closing tag and the *tail* is the closing tag. Deriving a frame from a base frame with some parameters to append,
+	 * the *head* is shared with (not copied from) the base frame and only the appended parameters are serialized into
+	 * the *tail*. Thus, a big message delivered to many systems with small differences, like pieces of
+	 * {@link ParallelSystemArray.sendPieceData}, is encoded only once.
+	 *
+	 * Binary parameters ({@link ByteArray}) are not copied into the frame. They're referenced from the source
+	 * {@link Invoke} message. Thus, do not modify the source {@link Invoke} message after the frame is constructed.
+	 *
+	 * @see {@link Communicator.sendFrame}, {@link Communicator.postFrame}
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class InvokeFrame
+	{
+	private:
+		std::shared_ptr<Invoke> invoke_;
+
+		std::shared_ptr<const std::string> head_;
+		size_t head_size_;
+		std::string tail_;
+
+		std::vector<std::shared_ptr<InvokeParameter>> binaries_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from an {@link Invoke} message.
+		 *
+		 * @param invoke An {@link Invoke} message to serialize.
+		 */
+		InvokeFrame(std::shared_ptr<Invoke> invoke)
+		{
+			construct(invoke);
+		};
+
+		/**
+		 * Derive from a base frame.
+		 *
+		 * Constructs a frame representing the *base* frame's {@link Invoke} message with *parameters* appended. The
+		 * *head* of the *base* frame is shared, so that only the *parameters* are serialized.
+		 *
+		 * @param base A base frame, containing the shared part of messages.
+		 * @param parameters Parameters to append, the part specific to this frame.
+		 */
+		InvokeFrame(std::shared_ptr<const InvokeFrame> base, const std::vector<std::shared_ptr<InvokeParameter>> &parameters)
+		{
+			// INVOKE MESSAGE SHARING PARAMETERS WITH THE BASE
+			std::shared_ptr<Invoke> invoke(new Invoke(base->invoke_->getListener()));
+			invoke->assign(base->invoke_->begin(), base->invoke_->end());
+			invoke->insert(invoke->end(), parameters.begin(), parameters.end());
+
+			if (base->tail_ != CLOSING_TAG())
+			{
+				// THE BASE HAS NO PARAMETER OR IS ALSO A DERIVED FRAME
+				construct(invoke);
+				return;
+			}
+			invoke_ = invoke;
+
+			// SHARE THE HEAD
+			head_ = base->head_;
+			head_size_ = base->head_size_;
+
+			// SERIALIZE ONLY THE APPENDED PARAMETERS
+			for (size_t i = 0; i < parameters.size(); i++)
+				tail_ += parameters[i]->toXML()->toString(1);
+			tail_ += CLOSING_TAG();
+
+			// BINARIES, FOLLOWING ORDER OF THE PARAMETERS
+			binaries_ = base->binaries_;
+			for (size_t i = 0; i < parameters.size(); i++)
+				if (parameters[i]->getType() == "ByteArray")
+					binaries_.push_back(parameters[i]);
+		};
+
+	private:
+		void construct(std::shared_ptr<Invoke> invoke)
+		{
+			invoke_ = invoke;
+			head_ = std::make_shared<std::string>(invoke->toXML()->toString());
+			head_size_ = head_->size();
+
+			// SEPARATE THE CLOSING TAG
+			const std::string &closing_tag = CLOSING_TAG();
+			if (head_size_ >= closing_tag.size()
+				&& head_->compare(head_size_ - closing_tag.size(), closing_tag.size(), closing_tag) == 0)
+			{
+				head_size_ -= closing_tag.size();
+				tail_ = closing_tag;
+			}
+
+			for (size_t i = 0; i < invoke->size(); i++)
+				if (invoke->at(i)->getType() == "ByteArray")
+					binaries_.push_back(invoke->at(i));
+		};
+
+		static auto CLOSING_TAG() -> const std::string&
+		{
+			static const std::string tag = "</invoke>\n";
+			return tag;
+		};
+
+	public:
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get the source {@link Invoke} message.
+		 */
+		auto getInvoke() const -> std::shared_ptr<Invoke>
+		{
+			return invoke_;
+		};
+
+		/**
+		 * Get size of the serialized string, sum of the *head* and *tail*.
+		 */
+		auto size() const -> size_t
+		{
+			return head_size_ + tail_.size();
+		};
+
+		/**
+		 * Get the *head*, a part of the serialized string which can be shared with other frames.
+		 */
+		auto getHead() const -> WeakString
+		{
+			return WeakString(head_->data(), head_size_);
+		};
+
+		/**
+		 * Get the *tail*, a part of the serialized string following the {@link getHead head}.
+		 */
+		auto getTail() const -> const std::string&
+		{
+			return tail_;
+		};
+
+		/**
+		 * Get binary parameters, to be sent after the serialized string.
+		 */
+		auto getBinaries() const -> const std::vector<std::shared_ptr<InvokeParameter>>&
+		{
+			return binaries_;
+		};
+
+		/* ---------------------------------------------------------
+			EXPORTERS
+		--------------------------------------------------------- */
+		/**
+		 * Get the whole serialized string.
+		 *
+		 * Concatenates the {@link getHead head} and {@link getTail tail}. Note that, it copies the *head*.
+		 */
+		auto toString() const -> std::string
+		{
+			std::string str;
+			str.reserve(size());
+			str.append(head_->data(), head_size_);
+			str.append(tail_);
+
+			return str;
+		};
+	};
+};
+};
\ No newline at end of file
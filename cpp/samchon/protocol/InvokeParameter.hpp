@@ -84,6 +84,11 @@ namespace protocol
 		 */
 		ByteArray byte_array;
 
+		/**
+		 * @brief A binary value shared with another parameter, instead of the byte_array
+		 */
+		std::shared_ptr<const ByteArray> shared_byte_array;
+
 	public:
 		/* ----------------------------------------------------------
 			CONSTRUCTORS
@@ -188,6 +193,19 @@ namespace protocol
 			this->byte_array = move(byte_array);
 		};
 
+		/**
+		 * @brief Construct from name and a shared ByteArray
+		 *
+		 * @details The ByteArray is referenced, without copying. Do not modify it.
+		 */
+		InvokeParameter(const std::string &name, std::shared_ptr<const ByteArray> byte_array)
+		{
+			this->name = name;
+			this->type = "ByteArray";
+
+			this->shared_byte_array = byte_array;
+		};
+
 		virtual ~InvokeParameter() = default;
 
 		virtual void construct(std::shared_ptr<library::XML> xml) override
@@ -210,6 +228,7 @@ namespace protocol
 			{
 				size_t size = xml->getValue<size_t>();
 
+				shared_byte_array = nullptr;
 				byte_array.reserve(size);
 			}
 			else
@@ -223,6 +242,7 @@ namespace protocol
 
 		void setByteArray(ByteArray &&ba)
 		{
+			shared_byte_array = nullptr;
 			byte_array = move(ba);
 		};
 
@@ -309,7 +329,7 @@ namespace protocol
 		};
 		template<> auto getValue() const -> ByteArray
 		{
-			return byte_array;
+			return referValue<ByteArray>();
 		};
 
 		/**
@@ -333,7 +353,7 @@ namespace protocol
 		};
 		template<> auto referValue() const -> const ByteArray&
 		{
-			return byte_array;
+			return (shared_byte_array != nullptr) ? *shared_byte_array : byte_array;
 		};
 
 		/**
@@ -348,6 +368,9 @@ namespace protocol
 		};
 		template<> auto moveValue() -> ByteArray
 		{
+			if (shared_byte_array != nullptr)
+				return *shared_byte_array; // SHARED, THUS COPIED
+
 			return move(byte_array);
 		};
 
@@ -371,7 +394,7 @@ namespace protocol
 			if (type == "XML")
 				xml->push_back(this->xml);
 			else if (type == "ByteArray")
-				xml->setValue(byte_array.size());
+				xml->setValue(referValue<ByteArray>().size());
 			else
 				xml->setValue(str);
 
@@ -3,6 +3,9 @@
 
 #include <samchon/protocol/Communicator.hpp>
 
+#include <chrono>
+#include <functional>
+
 namespace samchon
 {
 namespace protocol
@@ -42,7 +45,15 @@ namespace protocol
 
 		std::unique_ptr<boost::asio::ip::tcp::endpoint> endpoint;
 
+	private:
+		std::chrono::steady_clock::duration timeout_{ std::chrono::steady_clock::duration::zero() };
+
 	public:
+		/**
+		 * Callback function called when connected, before listening.
+		 */
+		std::function<void()> onConnect;
+
 		/* -----------------------------------------------------------
 			CONSTRUCTORS
 		----------------------------------------------------------- */
@@ -62,6 +73,24 @@ namespace protocol
 		 */
 		virtual ~ServerConnector() = default;
 
+		/* -----------------------------------------------------------
+			ACCESSORS
+		----------------------------------------------------------- */
+		/**
+		 * Get timeout of connecting.
+		 *
+		 * Zero, the default, means no deadline of its own; connecting to an unreachable host fails after the TCP 
+		 * timeout of the system, which may take minutes.
+		 */
+		auto getTimeout() const -> std::chrono::steady_clock::duration
+		{
+			return timeout_;
+		};
+		void setTimeout(std::chrono::steady_clock::duration val)
+		{
+			timeout_ = val;
+		};
+
 		/* -----------------------------------------------------------
 			CONNECTOR
 		----------------------------------------------------------- */
@@ -83,11 +112,15 @@ namespace protocol
 		 *			 If you do not specify a host, use an event listener to determine whether the connection was 
 		 *			 successful.
 		 * @param port The port number to connect to.
+		 * @throw boost::system::system_error If failed to connect, or the {@link getTimeout timeout} has expired.
 		 */
 		virtual void connect(const std::string &ip, int port)
 		{
 			_Connect(ip, port);
 
+			if (onConnect != nullptr)
+				onConnect();
+
 			listen_message();
 		};
 
@@ -101,7 +134,39 @@ namespace protocol
 			endpoint.reset(new boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(ip), port));
 
 			socket.reset(new boost::asio::ip::tcp::socket(*io_service, boost::asio::ip::tcp::v4()));
-			socket->connect(*endpoint);
+			if (timeout_ <= std::chrono::steady_clock::duration::zero())
+			{
+				socket->connect(*endpoint);
+				return;
+			}
+
+			// CONNECT ASYNCHRONOUSLY, RACING WITH THE DEADLINE
+			boost::system::error_code error = boost::asio::error::would_block;
+			bool expired = false;
+
+			boost::asio::steady_timer timer(*io_service, timeout_);
+			socket->async_connect(*endpoint, [&error, &timer](const boost::system::error_code &ec)
+			{
+				error = ec;
+				timer.cancel();
+			});
+			timer.async_wait([this, &error, &expired](const boost::system::error_code &ec)
+			{
+				if (ec == boost::asio::error::operation_aborted || error != boost::asio::error::would_block)
+					return;
+
+				// ABORT THE CONNECTING
+				expired = true;
+				socket->close();
+			});
+
+			io_service->run();
+			io_service->reset();
+
+			if (expired == true)
+				throw boost::system::system_error(boost::asio::error::timed_out, "Connection timed out");
+			else if (error)
+				throw boost::system::system_error(error);
 		};
 	};
 };
@@ -44,29 +44,30 @@ namespace protocol
 		{
 			this->is_server = is_server;
 		};
-		virtual ~WebCommunicator() = default;
+		virtual ~WebCommunicator()
+		{
+			_Stop_writer();
+		};
 
-		virtual void sendData(std::shared_ptr<Invoke> invoke) override
+	protected:
+		virtual void _Write_frame(std::shared_ptr<const InvokeFrame> frame) override
 		{
 			std::unique_lock<std::mutex> uk(send_mtx);
 
 			// SEND INVOKE
-			const std::string &str = invoke->toXML()->toString();
 			if (is_server == true)
-				send_data(str);
-			else // CLIENT MASKS ON SENDING DATA
-				send_masked_data(str);
+				send_frame_string(*frame);
+			else // CLIENT MASKS ON SENDING DATA, THUS THE HEAD IS COPIED ANYWAY
+				send_masked_data(frame->toString());
 
 			// SEND BINARY
-			for (size_t i = 0; i < invoke->size(); i++)
-				if (invoke->at(i)->getType() == "ByteArray")
-					if (is_server == true)
-						send_data(invoke->at(i)->referValue<ByteArray>());
-					else // CLIENT MASKS ON SENDING DATA
-						send_masked_data(invoke->at(i)->referValue<ByteArray>());
+			for (size_t i = 0; i < frame->getBinaries().size(); i++)
+				if (is_server == true)
+					send_data(frame->getBinaries()[i]->referValue<ByteArray>());
+				else // CLIENT MASKS ON SENDING DATA
+					send_masked_data(frame->getBinaries()[i]->referValue<ByteArray>());
 		};
 
-	protected:
 		/* =========================================================
 			SOCKET I/O
 				- READ
@@ -254,11 +255,23 @@ namespace protocol
 			unsigned char op_code = std::is_same<std::string, Container>()
 				? WebSocketUtil::TEXT
 				: WebSocketUtil::BINARY;
-			size_t size = data.size();
 
-			///////
-			// SEND HEADER
-			///////
+			socket->write_some(boost::asio::buffer(construct_header(op_code, data.size()))); // SEND HEADER
+			socket->write_some(boost::asio::buffer(data)); // SEND DATA
+		};
+
+		void send_frame_string(const InvokeFrame &frame)
+		{
+			// HEAD IS SHARED WITH OTHER FRAMES, THUS WRITE IT WITHOUT CONCATENATION
+			WeakString head = frame.getHead();
+
+			boost::asio::write(*socket, boost::asio::buffer(construct_header(WebSocketUtil::TEXT, frame.size())));
+			boost::asio::write(*socket, boost::asio::buffer(head.data(), head.size()));
+			boost::asio::write(*socket, boost::asio::buffer(frame.getTail()));
+		};
+
+		auto construct_header(unsigned char op_code, size_t size) const -> ByteArray
+		{
 			ByteArray header;
 			header.write(op_code);
 
@@ -274,9 +287,7 @@ namespace protocol
 				header.write((unsigned char)(WebSocketUtil::EIGHT_BYTES));
 				header.writeReversely((unsigned long long)size);
 			}
-
-			socket->write_some(boost::asio::buffer(header)); // SEND HEADER
-			socket->write_some(boost::asio::buffer(data)); // SEND DATA
+			return header;
 		};
 
 		template <class Container>
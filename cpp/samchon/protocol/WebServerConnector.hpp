@@ -109,6 +109,9 @@ namespace protocol
 
 			handshake(ip, port, path);
 
+			if (onConnect != nullptr)
+				onConnect();
+
 			listen_message();
 		};
 
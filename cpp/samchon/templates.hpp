@@ -5,4 +5,6 @@
 #include <samchon/templates/external.hpp>
 #include <samchon/templates/parallel.hpp>
 #include <samchon/templates/distributed.hpp>
-#include <samchon/templates/slave.hpp>
\ No newline at end of file
+#include <samchon/templates/slave.hpp>
+#include <samchon/templates/simulation.hpp>
+#include <samchon/templates/tracing.hpp>
\ No newline at end of file
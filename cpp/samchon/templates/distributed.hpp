@@ -11,4 +11,12 @@
 #	include <samchon/templates/distributed/DistributedClientArrayMediator.hpp>
 #	include <samchon/templates/distributed/DistributedServerArrayMediator.hpp>
 #	include <samchon/templates/distributed/DistributedServerClientArrayMediator.hpp>
-#include <samchon/templates/parallel/MediatorSystem.hpp>
\ No newline at end of file
+#include <samchon/templates/parallel/MediatorSystem.hpp>
+
+#include <samchon/templates/distributed/SystemSelector.hpp>
+#	include <samchon/templates/distributed/AffinitySelector.hpp>
+#	include <samchon/templates/distributed/LeastWorkSelector.hpp>
+#	include <samchon/templates/distributed/PowerOfTwoSelector.hpp>
+#	include <samchon/templates/distributed/WeightedQueueSelector.hpp>
+#include <samchon/templates/distributed/AffinityMatrix.hpp>
+#include <samchon/templates/distributed/AffinityRouter.hpp>
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <algorithm>
+#include <samchon/HashMap.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace distributed
+{
+	class DistributedProcess;
+	class DistributedSystem;
+
+	/**
+	 * A matrix of affinities between processes and systems.
+	 *
+	 * The {@link AffinityMatrix} learns elapsed time per unit weight of each pair of {@link DistributedProcess} and
+	 * {@link DistributedSystem}, from the {@link DSInvokeHistory histories} of **distributed processes**. The 
+	 * scalar indices, {@link DistributedProcess.getResource resource} and 
+	 * {@link DistributedSystem.getPerformance performance}, assume a system fast for a process is fast for all the 
+	 * processes. This matrix does not; a system can be fast for compute-bound processes, but slow for memory-bound
+	 * ones.
+	 *
+	 * Each cell is an exponentially weighted moving average of the observations, costing constant time and memory.
+	 *
+	 * @see {@link AffinitySelector}, {@link DistributedSystemArray.getAffinityMatrix}
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class AffinityMatrix
+	{
+	private:
+		struct Cell
+		{
+			double average;
+			size_t count;
+		};
+
+		HashMap<const DistributedProcess*, HashMap<const DistributedSystem*, Cell>> cells_;
+		double alpha_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from smoothing factor.
+		 *
+		 * @param alpha Smoothing factor of the moving averages, in (0, 1].
+		 */
+		AffinityMatrix(double alpha = .2)
+		{
+			alpha_ = std::min<double>(std::max<double>(alpha, .001), 1.0);
+		};
+
+		/**
+		 * Erase cells of a system.
+		 *
+		 * @param system A system to be erased.
+		 */
+		void erase(const DistributedSystem *system)
+		{
+			for (auto it = cells_.begin(); it != cells_.end(); it++)
+				it->second.erase(system);
+		};
+
+		/**
+		 * Erase cells of a process.
+		 *
+		 * @param process A process to be erased.
+		 */
+		void erase(const DistributedProcess *process)
+		{
+			cells_.erase(process);
+		};
+
+		void clear()
+		{
+			cells_.clear();
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get estimated elapsed time per unit weight.
+		 *
+		 * @return The estimated time, ```-1``` if the pair has not been observed.
+		 */
+		auto estimate(const DistributedProcess *process, const DistributedSystem *system) const -> double
+		{
+			const Cell *cell = find(process, system);
+			return (cell == nullptr) ? -1 : cell->average;
+		};
+
+		/**
+		 * Get number of observations of a pair.
+		 */
+		auto count(const DistributedProcess *process, const DistributedSystem *system) const -> size_t
+		{
+			const Cell *cell = find(process, system);
+			return (cell == nullptr) ? 0 : cell->count;
+		};
+
+		/**
+		 * Get confidence of the estimation, ```n / (n + 2)``` where *n* is number of observations.
+		 */
+		auto getConfidence(const DistributedProcess *process, const DistributedSystem *system) const -> double
+		{
+			double n = (double)count(process, system);
+			return n / (n + 2.0);
+		};
+
+		/* ---------------------------------------------------------
+			OBSERVATION
+		--------------------------------------------------------- */
+		/**
+		 * Observe a **distributed process**.
+		 *
+		 * @param process The process requested.
+		 * @param system The system has processed.
+		 * @param elapsedTime Elapsed time per unit weight.
+		 */
+		void observe(const DistributedProcess *process, const DistributedSystem *system, double elapsedTime)
+		{
+			if (elapsedTime < 0.0)
+				return;
+
+			HashMap<const DistributedSystem*, Cell> &row = cells_[process];
+			auto it = row.find(system);
+
+			if (it == row.end())
+				row.emplace(system, Cell{ elapsedTime, 1 });
+			else
+			{
+				it->second.average = alpha_ * elapsedTime + (1 - alpha_) * it->second.average;
+				it->second.count++;
+			}
+		};
+
+	private:
+		auto find(const DistributedProcess *process, const DistributedSystem *system) const -> const Cell*
+		{
+			auto row = cells_.find(process);
+			if (row == cells_.end())
+				return nullptr;
+
+			auto it = row->second.find(system);
+			return (it == row->second.end()) ? nullptr : &it->second;
+		};
+	};
+};
+};
+};
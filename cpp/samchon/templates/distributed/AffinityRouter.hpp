@@ -0,0 +1,206 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/distributed/DistributedSystem.hpp>
+
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <cmath>
+#include <algorithm>
+#include <iterator>
+#include <functional>
+
+namespace samchon
+{
+namespace templates
+{
+namespace distributed
+{
+	/**
+	 * A router of affinity keys.
+	 *
+	 * The {@link AffinityRouter} maps an *affinity key*, given to {@link DistributedProcess.sendData}, to a preferred
+	 * {@link DistributedSystem} by *consistent hashing*. **Distributed processes** touching a same dataset, with a 
+	 * same *affinity key*, are sent to a same system and hit its warm caches. When a system joins or leaves, only the
+	 * keys mapped to the system are moved.
+	 *
+	 * Loads are *bounded*. Capacity of a system is ```(1 + epsilon)``` times of its share of the total load, 
+	 * proportional to its {@link DistributedSystem.getPerformance performance index}. If the preferred system is 
+	 * overloaded, the next systems on the ring are tried. Thus, a hot key does not overload a system.
+	 *
+	 * Numbers of *hits*, routed to the preferred system, and *misses*, routed to another one, are counted for tuning.
+	 *
+	 * @see {@link DistributedSystemArray.getAffinityRouter}
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class AffinityRouter
+	{
+	private:
+		// RING OF VIRTUAL NODES
+		std::map<size_t, const DistributedSystem*> ring_;
+		std::vector<const DistributedSystem*> members_;
+		std::mutex mtx_;
+
+		size_t replicas_;
+		double epsilon_;
+
+		std::atomic<size_t> hits_{ 0 };
+		std::atomic<size_t> misses_{ 0 };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from options.
+		 *
+		 * @param replicas Number of virtual nodes per system on the ring.
+		 * @param epsilon Allowed overload ratio; capacity of a system is ```(1 + epsilon)``` times of its share.
+		 */
+		AffinityRouter(size_t replicas = 64, double epsilon = .25)
+		{
+			replicas_ = std::max<size_t>(replicas, 1);
+			epsilon_ = std::max<double>(epsilon, 0.0);
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		auto getEpsilon() const -> double
+		{
+			return epsilon_;
+		};
+		void setEpsilon(double val)
+		{
+			epsilon_ = std::max<double>(val, 0.0);
+		};
+
+		/**
+		 * Get number of hits, routed to the preferred system.
+		 */
+		auto getHits() const -> size_t
+		{
+			return hits_.load();
+		};
+
+		/**
+		 * Get number of misses, routed to another system because the preferred one was overloaded.
+		 */
+		auto getMisses() const -> size_t
+		{
+			return misses_.load();
+		};
+
+		void resetCounters()
+		{
+			hits_ = 0;
+			misses_ = 0;
+		};
+
+		/* ---------------------------------------------------------
+			ROUTING
+		--------------------------------------------------------- */
+		/**
+		 * Route an affinity key.
+		 *
+		 * @param key An affinity key.
+		 * @param systems Candidate systems.
+		 * @param weight Weight of the **distributed process** to allocate.
+		 *
+		 * @return The system to allocate, ```nullptr``` if all the systems are overloaded.
+		 */
+		auto route(const std::string &key, const std::vector<std::shared_ptr<DistributedSystem>> &systems, double weight)
+			-> std::shared_ptr<DistributedSystem>
+		{
+			if (systems.empty() == true)
+				return nullptr;
+
+			// TOTAL LOAD AND PERFORMANCE, INCLUDING THE NEW ONE
+			HashMap<const DistributedSystem*, std::shared_ptr<DistributedSystem>> system_map;
+			double total_load = weight;
+			double total_performance = 0.0;
+
+			for (size_t i = 0; i < systems.size(); i++)
+			{
+				system_map.emplace(systems[i].get(), systems[i]);
+				total_load += systems[i]->_Get_load_weight();
+				total_performance += systems[i]->getPerformance();
+			}
+
+			// WALK THE RING FROM THE KEY
+			std::unique_lock<std::mutex> uk(mtx_);
+			synchronize(systems);
+
+			auto it = ring_.lower_bound(std::hash<std::string>()(key));
+			for (size_t i = 0; i < ring_.size(); i++, it++)
+			{
+				if (it == ring_.end())
+					it = ring_.begin();
+
+				if (system_map.has(it->second) == false)
+					continue;
+
+				std::shared_ptr<DistributedSystem> system = system_map.get(it->second);
+				double capacity = (1 + epsilon_) * total_load * system->getPerformance() / std::max<double>(total_performance, 1e-9);
+
+				if (system->_Get_load_weight() + weight <= capacity)
+				{
+					(i == 0 ? hits_ : misses_)++;
+					return system;
+				}
+			}
+
+			misses_++;
+			return nullptr;
+		};
+
+	private:
+		void synchronize(const std::vector<std::shared_ptr<DistributedSystem>> &systems)
+		{
+			std::vector<const DistributedSystem*> members;
+			members.reserve(systems.size());
+
+			for (size_t i = 0; i < systems.size(); i++)
+				members.push_back(systems[i].get());
+			std::sort(members.begin(), members.end());
+
+			if (members == members_)
+				return;
+
+			// MEMBERS HAVE CHANGED; ADJUST THE RING
+			std::vector<const DistributedSystem*> erased;
+			std::vector<const DistributedSystem*> inserted;
+
+			std::set_difference(members_.begin(), members_.end(), members.begin(), members.end(), std::back_inserter(erased));
+			std::set_difference(members.begin(), members.end(), members_.begin(), members_.end(), std::back_inserter(inserted));
+
+			for (size_t i = 0; i < erased.size(); i++)
+				for (size_t r = 0; r < replicas_; r++)
+				{
+					auto it = ring_.find(compute_point(erased[i], r));
+					if (it != ring_.end() && it->second == erased[i])
+						ring_.erase(it);
+				}
+			for (size_t i = 0; i < inserted.size(); i++)
+				for (size_t r = 0; r < replicas_; r++)
+					ring_[compute_point(inserted[i], r)] = inserted[i];
+
+			members_ = std::move(members);
+		};
+
+		static auto compute_point(const DistributedSystem *system, size_t replica) -> size_t
+		{
+			// SPLITMIX64
+			unsigned long long x = (unsigned long long)(size_t)system ^ ((unsigned long long)replica * 0x9E3779B97F4A7C15ull);
+			x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+			x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+			x = x ^ (x >> 31);
+
+			return (size_t)x;
+		};
+	};
+};
+};
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/distributed/SystemSelector.hpp>
+#include <samchon/templates/distributed/DistributedProcess.hpp>
+#include <samchon/templates/distributed/AffinityMatrix.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace distributed
+{
+	/**
+	 * A selector by affinity.
+	 *
+	 * The {@link AffinitySelector} selects the {@link DistributedSystem} expected to finish the 
+	 * **distributed process** first, with elapsed time per unit weight learned by the {@link AffinityMatrix} for each
+	 * pair of process and system. Thus, each type of process lands on the system it runs best.
+	 *
+	 * ```
+	 * cost = (outstanding weight + weight) * time(process, system)
+	 * ```
+	 *
+	 * While a pair has few observations, its time is blended with the prior from the scalar indices, average elapsed
+	 * time of the process divided by {@link DistributedSystem.getPerformance performance index} of the system, by the
+	 * {@link AffinityMatrix.getConfidence confidence}. If neither is known for some system, it works as the 
+	 * {@link LeastWorkSelector}.
+	 *
+	 * It's the default {@link SystemSelector} of {@link DistributedSystemArray}.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class AffinitySelector
+		: public SystemSelector
+	{
+	public:
+		virtual ~AffinitySelector() = default;
+
+		virtual auto select(const DistributedProcess *process, const std::vector<std::shared_ptr<DistributedSystem>> &systems, double weight)
+			-> std::shared_ptr<DistributedSystem> override
+		{
+			const AffinityMatrix &matrix = process->getSystemArray<base::DistributedSystemArrayBase>()->getAffinityMatrix();
+			double prior = process->_Compute_average_elapsed_time();
+
+			// ESTIMATE TIMES PER UNIT WEIGHT
+			HashMap<const DistributedSystem*, double> times;
+			for (size_t i = 0; i < systems.size(); i++)
+			{
+				const DistributedSystem *system = systems[i].get();
+
+				double time = (prior < 0.0) ? -1.0 : prior / std::max<double>(system->getPerformance(), 1e-9);
+				double learned = matrix.estimate(process, system);
+
+				if (learned >= 0.0)
+				{
+					double confidence = matrix.getConfidence(process, system);
+					time = (time < 0.0) ? learned : confidence * learned + (1 - confidence) * time;
+				}
+
+				if (time < 0.0)
+				{
+					// NOTHING IS KNOWN; LEAST WORK
+					return select_min(systems, [weight](const DistributedSystem *system) -> double
+					{
+						return compute_work(system, weight);
+					});
+				}
+				times.emplace(system, time);
+			}
+
+			// THROTTLED BY BACKLOGS OF THE SLAVES
+			return select_min(systems, [&times, weight](const DistributedSystem *system) -> double
+			{
+				return (system->_Get_load_weight() + weight) * times.get(system) / system->_Compute_availability(false);
+			});
+		};
+	};
+};
+};
+};
@@ -5,9 +5,12 @@
 #include <samchon/protocol/Entity.hpp>
 
 #include <samchon/protocol/Invoke.hpp>
+#include <samchon/protocol/InvokeFrame.hpp>
 #include <samchon/templates/distributed/DSInvokeHistory.hpp>
 
 #include <samchon/templates/distributed/DistributedSystem.hpp>
+#include <samchon/templates/distributed/SystemSelector.hpp>
+#include <samchon/templates/distributed/AffinityRouter.hpp>
 #include <samchon/templates/distributed/base/DistributedSystemArrayBase.hpp>
 #include <samchon/templates/parallel/base/ParallelSystemArrayBase.hpp>
 
@@ -237,6 +240,9 @@ namespace distributed
 		 * {@link getResource resource index} and {@link DistributedSystem.getPerformance performance index} of this
 		 * {@link DistributedSystem} and the most idle {@link DistributedSystem} objects basis on the execution time.
 		 *
+		 * The ```_History_uid``` parameter is attached to the *invoke*. With the *invoke*, the **distributed process** 
+		 * can be {@link ParallelSystemArray.cancel cancelled}.
+		 *
 		 * @param invoke An {@link Invoke} message requesting distributed process.
 		 * @param weight Weight of resource which indicates how heavy this {@link Invoke} message is. Default is 1.
 		 *
@@ -244,17 +250,77 @@ namespace distributed
 		 */
 		virtual auto sendData(std::shared_ptr<protocol::Invoke> invoke, double weight) -> std::shared_ptr<DistributedSystem> override
 		{
-			std::shared_lock<std::shared_mutex> uk(((external::base::ExternalSystemArrayBase*)system_array_)->getMutex());
-			if (((protocol::SharedEntityDeque<external::ExternalSystem>*)system_array_)->empty() == true)
+			attach_uid(invoke);
+			return sendFrame(std::make_shared<protocol::InvokeFrame>(invoke), weight);
+		};
+
+		/**
+		 * Send an {@link Invoke} message with affinity key.
+		 *
+		 * Sends an {@link Invoke} message requesting a **distributed process** to the system preferred by the 
+		 * *affinity key*. **Distributed processes** touching a same dataset should have a same *affinity key*, then 
+		 * they're sent to a same system, hitting its warm caches. The key is mapped to a system by consistent hashing of
+		 * the {@link DistributedSystemArray.getAffinityRouter affinity router}. If the preferred system is overloaded,
+		 * another system is selected.
+		 *
+		 * @param invoke An {@link Invoke} message requesting distributed process.
+		 * @param weight Weight of resource which indicates how heavy this {@link Invoke} message is.
+		 * @param affinityKey A key identifying the dataset.
+		 *
+		 * @return The {@link DistributedSystem} object who may send the {@link Invoke} message.
+		 */
+		auto sendData(std::shared_ptr<protocol::Invoke> invoke, double weight, const std::string &affinityKey) -> std::shared_ptr<DistributedSystem>
+		{
+			attach_uid(invoke);
+			return sendFrame(std::make_shared<protocol::InvokeFrame>(invoke), weight, affinityKey);
+		};
+
+		/**
+		 * Send a serialized {@link Invoke} message.
+		 *
+		 * Sends an {@link InvokeFrame}, a serialized {@link Invoke} message, requesting a **distributed process**. Only
+		 * the parameters required for the **distributed process** (unique id, name of this process and *weight*) are 
+		 * appended to the *frame*, so the *frame* is not serialized again. When you request a lot of 
+		 * **distributed processes** with a same and big {@link Invoke} message, construct an {@link InvokeFrame} once 
+		 * and call this {@link sendFrame} with it repeatedly.
+		 *
+		 * @param frame A serialized {@link Invoke} message requesting distributed process.
+		 * @param weight Weight of resource which indicates how heavy this {@link Invoke} message is. Default is 1.
+		 * @param affinityKey A key identifying the dataset, to prefer a same system. Default is empty, no affinity.
+		 *
+		 * @return The most idle {@link DistributedSystem} object who may send the {@link Invoke} message.
+		 */
+		auto sendFrame(std::shared_ptr<const protocol::InvokeFrame> frame, double weight = 1.0, std::string affinityKey = "") -> std::shared_ptr<DistributedSystem>
+		{
+			std::shared_ptr<protocol::Invoke> invoke = frame->getInvoke();
+			std::vector<std::shared_ptr<protocol::InvokeParameter>> parameters; // TO BE APPENDED
+
+			parallel::base::ParallelSystemArrayBase *system_array = (parallel::base::ParallelSystemArrayBase*)system_array_;
+			std::chrono::system_clock::time_point dispatched = system_array->_Now();
+
+			// CANDIDATES, EXCEPT THE BEING REMOVED SYSTEMS; FROM THE SNAPSHOT, WITHOUT LOCKING THE MEMBERSHIP
+			std::shared_ptr<const std::vector<std::shared_ptr<external::ExternalSystem>>> children = ((external::base::ExternalSystemArrayBase*)system_array_)->_Get_snapshot();
+			std::vector<std::shared_ptr<DistributedSystem>> systems;
+
+			systems.reserve(children->size());
+			for (size_t i = 0; i < children->size(); i++)
+			{
+				std::shared_ptr<DistributedSystem> system = std::dynamic_pointer_cast<DistributedSystem>(children->at(i));
+				if (system != nullptr && system->_Is_excluded() == false)
+					systems.push_back(system);
+			}
+			if (systems.empty() == true)
 				return nullptr;
 
 			// ADD UID FOR ARCHIVING HISTORY
 			size_t uid;
-			if (invoke->has("_History_uid") == false)
+			bool issued = (invoke->has("_History_uid") == false);
+
+			if (issued == true)
 			{
-				// ISSUE UID AND ATTACH IT TO INVOKE'S LAST PARAMETER
+				// ISSUE UID, WITHOUT ANY LOCK, AND ATTACH IT TO INVOKE'S LAST PARAMETER
 				uid = ((parallel::base::ParallelSystemArrayBase*)system_array_)->_Fetch_history_sequence();
-				invoke->emplace_back(new protocol::InvokeParameter("_History_uid", uid));
+				parameters.emplace_back(new protocol::InvokeParameter("_History_uid", uid));
 			}
 			else
 			{
@@ -262,63 +328,88 @@ namespace distributed
 				//	- system_array_ IS A TYPE OF DistributedSystemArrayMediator. THE MESSAGE HAS COME FROM ITS MASTER
 				//	- A Distributed HAS DISCONNECTED. THE SYSTEM SHIFTED ITS CHAIN TO ANOTHER SLAVE.
 				uid = invoke->get("_History_uid")->getValue<size_t>();
+			}
 
-				// FOR CASE 1. UPDATE HISTORY_SEQUENCE TO MAXIMUM
-				if (uid > ((parallel::base::ParallelSystemArrayBase*)system_array_)->_Get_history_sequence())
-					((parallel::base::ParallelSystemArrayBase*)system_array_)->_Set_history_sequence(uid);
+			std::unique_lock<std::recursive_mutex> uk(((parallel::base::ParallelSystemArrayBase*)system_array_)->_Get_state_mutex());
 
-				// FOR CASE 2. ERASE ORDINARY PROGRESSIVE HISTORY FROM THE DISCONNECTED
+			if (issued == false)
+			{
+				// THE PROCESS HAS BEEN CANCELLED
+				if (((parallel::base::ParallelSystemArrayBase*)system_array_)->_Is_cancelled(uid) == true)
+					return nullptr;
+
+				// ERASE ORDINARY PROGRESSIVE HISTORY FROM THE DISCONNECTED
 				progress_list_.erase(uid);
 			}
 
 			// ADD ROLE NAME FOR MEDIATOR
 			if (invoke->has("_Process_name") == false)
-				invoke->emplace_back(new protocol::InvokeParameter("_Process_name", name));
+				parameters.emplace_back(new protocol::InvokeParameter("_Process_name", name));
 			if (invoke->has("_Process_weight") == false)
-				invoke->emplace_back(new protocol::InvokeParameter("_Process_weight", weight));
+				parameters.emplace_back(new protocol::InvokeParameter("_Process_weight", weight));
 			else
 				weight = invoke->get("_Process_weight")->getValue<double>();
 
-			// FIND THE MOST IDLE SYSTEM
-			std::vector<std::shared_ptr<external::ExternalSystem>> children;
-			std::shared_ptr<DistributedSystem> idle_system;
+			// TRACE BY THE TRACER, OR BY THE UPPER MASTER
+			bool traced = invoke->has("_Trace");
+			if (traced == false && system_array->getTracer().isEnabled() == true)
+			{
+				parameters.emplace_back(new protocol::InvokeParameter("_Trace", true));
+				traced = true;
+			}
+
+			// KEEP AFFINITY KEY FOR RE-SENDING
+			if (invoke->has("_Affinity_key") == true)
+				affinityKey = invoke->get("_Affinity_key")->getValue<std::string>();
+			else if (affinityKey.empty() == false)
+				parameters.emplace_back(new protocol::InvokeParameter("_Affinity_key", affinityKey));
 
-			for (size_t i = 0; i < children.size(); i++)
+			// APPEND THE PARAMETERS WITHOUT RE-SERIALIZING THE FRAME
+			if (parameters.empty() == false)
 			{
-				std::shared_ptr<DistributedSystem> system = std::dynamic_pointer_cast<DistributedSystem>(children.at(i));
-				if (system->_Is_excluded() == true)
-					continue; // BEING REMOVED SYSTEM
-
-				if (idle_system == nullptr // NO IDLE SYSTEM YET
-					|| (system->_Get_progress_list().empty() && system->_Get_history_list().empty()) // NOTHING HAS REQUESTED
-					|| system->_Get_progress_list().size() < idle_system->_Get_progress_list().size() // LESS NUMBER OF PROGRESS
-					|| (
-						system->_Get_progress_list().size() == idle_system->_Get_progress_list().size() &&
-						system->getPerformance() > idle_system->getPerformance() // GREATER PERFORMANCE
-					)
-					|| (
-						system->_Get_progress_list().size() == idle_system->_Get_progress_list().size() &&
-						system->getPerformance() == idle_system->getPerformance() &&
-						system->_Get_history_list().size() < idle_system->_Get_history_list().size()) // LESS HISTORY
-					)
-						idle_system = system;
+				frame.reset(new protocol::InvokeFrame(frame, parameters));
+				invoke = frame->getInvoke();
 			}
 
+			// THE SYSTEM PREFERRED BY AFFINITY KEY, OR THE MOST IDLE SYSTEM BY THE SELECTOR
+			std::shared_ptr<DistributedSystem> idle_system;
+			if (affinityKey.empty() == false)
+				idle_system = system_array_->getAffinityRouter()->route(affinityKey, systems, weight);
+			if (idle_system == nullptr)
+				idle_system = system_array_->getSelector()->select(this, systems, weight);
+
 			// ARCHIVE HISTORY ON PROGRESS_LIST (IN SYSTEM AND ROLE AT THE SAME TIME)
 			std::shared_ptr<DSInvokeHistory> history(new DSInvokeHistory(idle_system.get(), this, invoke, weight));
+			history->setStartTime(((parallel::base::ParallelSystemArrayBase*)system_array_)->_Now());
 
 			progress_list_.emplace(uid, history);
-			idle_system->_Get_progress_list().emplace(uid, make_pair(invoke, history));
+			{
+				std::unique_lock<std::mutex> pk(idle_system->_Get_progress_mutex());
+				idle_system->_Get_progress_list().emplace(uid, make_pair(invoke, history));
+			}
+			idle_system->_Add_load(weight);
 
 			uk.unlock(); // SELECTING IDLE AND ARCHIVING HISTORY ENTITY ARE COMPLETED.
 
 			// SEND DATA
-			idle_system->sendData(invoke);
+			idle_system->sendFrame(frame);
+
+			if (traced == true)
+				system_array->getTracer().record("dispatch", uid, dispatched, system_array->_Now());
 
 			// RETURNS THE IDLE
 			return idle_system;
 		};
 
+	private:
+		void attach_uid(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			// ISSUE UID IN ADVANCE, TO BE CANCELLED BY THE INVOKE MESSAGE
+			if (invoke->has("_History_uid") == false)
+				invoke->emplace_back(new protocol::InvokeParameter("_History_uid", ((parallel::base::ParallelSystemArrayBase*)system_array_)->_Fetch_history_sequence()));
+		};
+
+	public:
 		/**
 		 * @inheritDoc
 		 */
@@ -347,26 +438,15 @@ namespace distributed
 		--------------------------------------------------------- */
 		auto _Compute_average_elapsed_time() const -> double
 		{
-			double sum = 0.0;
-
-			for (auto it = history_list_.begin(); it != history_list_.end(); it++)
-			{
-				std::shared_ptr<DSInvokeHistory> history = it->second;
-				double elapsed_time = history->computeElapsedTime() / history->getWeight();
-
-				// THE SYSTEM'S PERFORMANCE IS 5. THE SYSTEM CAN HANDLE A PROCESS VERY QUICKLY
-				// AND ELAPSED TIME OF THE PROCESS IS 3 SECONDS
-				// THEN I CONSIDER THE ELAPSED TIME AS 15 SECONDS.
-				sum += elapsed_time * history->getSystem()->getPerformance();
-			}
-			return sum / history_list_.size();
+			// MEAN OF THE ELAPSED TIMES, WHICH ARE NORMALIZED BY THE SYSTEMS' PERFORMANCES WHEN REPORTED
+			return history_list_.mean();
 		};
 
 		auto _Get_progress_list() -> HashMap<size_t, std::shared_ptr<DSInvokeHistory>>& { return progress_list_; };
 		auto _Get_progress_list() const -> const HashMap<size_t, std::shared_ptr<DSInvokeHistory>>& { return progress_list_; };
 
-		auto _Get_history_list() -> HashMap<size_t, std::shared_ptr<DSInvokeHistory>>& { return history_list_; };
-		auto _Get_history_list() const -> const HashMap<size_t, std::shared_ptr<DSInvokeHistory>>& { return history_list_; };
+		auto _Get_history_list() -> slave::HistoryWindow<DSInvokeHistory>& { return history_list_; };
+		auto _Get_history_list() const -> const slave::HistoryWindow<DSInvokeHistory>& { return history_list_; };
 
 		auto _Is_enforced() const -> bool
 		{
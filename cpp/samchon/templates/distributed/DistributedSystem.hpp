@@ -7,6 +7,9 @@
 #include <samchon/templates/distributed/base/DistributedSystemArrayBase.hpp>
 #include <samchon/templates/distributed/base/DistributedProcessBase.hpp>
 
+#include <atomic>
+#include <algorithm>
+
 namespace samchon
 {
 namespace templates
@@ -54,6 +57,10 @@ namespace distributed
 	private:
 		typedef parallel::ParallelSystem super;
 
+		// DISTRIBUTED PROCESSES ON PROGRESS; NUMBER AND SUM OF WEIGHTS
+		std::atomic<size_t> load_count_{ 0 };
+		std::atomic<double> load_weight_{ 0.0 };
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -63,17 +70,15 @@ namespace distributed
 		virtual ~DistributedSystem()
 		{
 			_Set_excluded();
+			if (system_array_ == nullptr)
+				return;
 
 			// SHIFT PARALLEL INVOKE MESSAGES HAD PROGRESSED TO OTHER SLAVES
-			for (auto it = _Get_progress_list().begin(); it != _Get_progress_list().end(); it++)
-			{
-				// INVOKE MESSAGE AND ITS HISTORY ON PROGRESS
-				std::shared_ptr<protocol::Invoke> invoke = it->second.first;
-				std::shared_ptr<slave::InvokeHistory> history = it->second.second;
+			std::unique_lock<std::recursive_mutex> sk(((parallel::base::ParallelSystemArrayBase*)system_array_)->_Get_state_mutex());
+			_Send_back_progress();
 
-				// SEND THEM BACK
-				_Send_back_history(invoke, history);
-			}
+			// FORGET AFFINITIES OF THIS SYSTEM
+			((base::DistributedSystemArrayBase*)system_array_)->_Erase_affinity(this);
 		};
 
 	protected:
@@ -100,27 +105,49 @@ namespace distributed
 		};
 
 	public:
-		auto _Compute_average_elapsed_time() const -> double
+		/* ---------------------------------------------------------
+			LOAD COUNTERS
+		--------------------------------------------------------- */
+		/**
+		 * Get number of distributed processes on progress.
+		 */
+		auto _Get_load_count() const -> size_t
 		{
-			double sum = 0.0;
-			size_t denominator = 0;
+			return load_count_.load();
+		};
 
-			for (auto it = _Get_history_list().begin(); it != _Get_history_list().end(); it++)
-			{
-				std::shared_ptr<DSInvokeHistory> history = std::dynamic_pointer_cast<DSInvokeHistory>(it->second);
-				if (history == nullptr)
-					continue;
+		/**
+		 * Get sum of weights of the distributed processes on progress.
+		 */
+		auto _Get_load_weight() const -> double
+		{
+			return load_weight_.load();
+		};
 
-				double elapsed_time = history->computeElapsedTime() / history->getWeight();
+		void _Add_load(double weight)
+		{
+			load_count_.fetch_add(1);
+			add_load_weight(weight);
+		};
+		void _Subtract_load(double weight)
+		{
+			load_count_.fetch_sub(1);
+			add_load_weight(-weight);
+		};
 
-				sum += elapsed_time / ((base::DistributedProcessBase*)(history->getProcess()))->getResource();
-				denominator++;
-			}
+	private:
+		void add_load_weight(double delta)
+		{
+			double expected = load_weight_.load();
+			while (load_weight_.compare_exchange_weak(expected, std::max<double>(expected + delta, 0.0)) == false)
+				continue;
+		};
 
-			if (denominator == 0)
-				return -1;
-			else
-				return sum / denominator;
+	public:
+		auto _Compute_average_elapsed_time() const -> double
+		{
+			// MEAN OF THE SAMPLES, WHICH ARE ACCUMULATED WHEN REPORTED
+			return _Get_history_list().mean();
 		};
 
 	public:
@@ -143,23 +170,43 @@ namespace distributed
 			std::shared_ptr<DSInvokeHistory> history = std::dynamic_pointer_cast<DSInvokeHistory>($history);
 			if (history != nullptr)
 			{
-				// RE-SEND INVOKE MESSAGE TO ANOTHER SLAVE VIA ROLE
-				((base::DistributedProcessBase*)(history->getProcess()))->sendData(invoke, history->getWeight());
+				// RE-SEND INVOKE MESSAGE TO ANOTHER SLAVE VIA ROLE, BY THE EXECUTOR
+				base::DistributedProcessBase *process = (base::DistributedProcessBase*)(history->getProcess());
+				double weight = history->getWeight();
+
+				_Subtract_load(weight);
+
+				((parallel::base::ParallelSystemArrayBase*)system_array_)->_Post([process, invoke, weight]()
+				{
+					process->sendData(invoke, weight);
+				});
 			}
 
 			// ERASE THE HISTORY
 			super::_Send_back_history(invoke, history);
 		};
-		
+
 	protected:
-		virtual void _Report_history(std::shared_ptr<library::XML> xml) override
+		virtual void _Drop_progress(std::shared_ptr<slave::InvokeHistory> $history) override
 		{
-			if (xml->hasProperty("_Piece_first") == true)
+			std::shared_ptr<DSInvokeHistory> history = std::dynamic_pointer_cast<DSInvokeHistory>($history);
+			if (history == nullptr)
+				return;
+
+			// RELEASE LOADS OF THE DISTRIBUTED PROCESSES, WITHOUT REPORTING TO THEM
+			_Subtract_load(history->getWeight());
+			((base::DistributedProcessBase*)(history->getProcess()))->_Cancel_history(history->getUID());
+		};
+
+
+		virtual void _Report_history(std::shared_ptr<library::XML> xml, std::shared_ptr<protocol::InvokeParameter> result) override
+		{
+			if (xml->hasProperty("first") == true)
 			{
 				//--------
 				// ParallelSystem's history -> PRInvokeHistory
 				//--------
-				super::_Report_history(xml);
+				super::_Report_history(xml, result);
 			}
 			else
 			{
@@ -170,22 +217,42 @@ namespace distributed
 				std::shared_ptr<DSInvokeHistory> history(new DSInvokeHistory(this));
 				history->construct(xml);
 
-				// IF THE HISTORY IS NOT EXIST IN PROGRESS, THEN TERMINATE REPORTING
-				std::unique_lock<std::shared_mutex> uk(system_array_->getMutex());
-				
-				auto progress_it = _Get_progress_list().find(history->getUID());
-				if (progress_it == _Get_progress_list().end())
-					return;
+				// ERASE FROM ORDINARY PROGRESS, ONLY WITH THE PROGRESS MUTEX OF THIS SYSTEM
+				{
+					std::unique_lock<std::mutex> pk(_Get_progress_mutex());
+
+					// IF THE HISTORY IS NOT EXIST IN PROGRESS, THEN TERMINATE REPORTING
+					auto progress_it = _Get_progress_list().find(history->getUID());
+					if (progress_it == _Get_progress_list().end())
+						return;
+
+					history->weight_ = std::dynamic_pointer_cast<DSInvokeHistory>(progress_it->second.second)->getWeight();
+					_Get_progress_list().erase(progress_it);
+				}
+				_Pair_backlog();
+				_Subtract_load(history->getWeight());
 
-				history->weight_ = std::dynamic_pointer_cast<DSInvokeHistory>(progress_it->second.second)->getWeight();
+				// MIGRATE TO THE HISTORY, WITH THE STATE MUTEX OF THE SYSTEM ARRAY
+				parallel::base::ParallelSystemArrayBase *system_array = (parallel::base::ParallelSystemArrayBase*)system_array_;
+				std::unique_lock<std::recursive_mutex> sk(system_array->_Get_state_mutex());
+
+				std::chrono::system_clock::time_point now = system_array->_Now();
+				double elapsed_time = history->computeElapsedTime() / history->getWeight();
+				if (history->getProcess() == nullptr)
+					_Get_history_list().insert(history->getUID(), history, now);
+				else
+				{
+					base::DistributedProcessBase *process = (base::DistributedProcessBase*)(history->getProcess());
 
-				// ERASE FROM ORDINARY PROGRESS AND MIGRATE TO THE HISTORY
-				_Get_progress_list().erase(progress_it);
-				_Get_history_list().emplace(history->getUID(), history);
+					// ELAPSED TIME PER UNIT RESOURCE OF THE PROCESS, FOR THE SYSTEM
+					_Get_history_list().insert(history->getUID(), history, elapsed_time / process->getResource(), now);
 
-				// ALSO NOTIFY TO THE ROLE
-				if (history->getProcess() != nullptr)
-					((base::DistributedProcessBase*)(history->getProcess()))->_Report_history(history);
+					// ALSO NOTIFY TO THE ROLE
+					// THE SYSTEM'S PERFORMANCE IS 5. THE SYSTEM CAN HANDLE A PROCESS VERY QUICKLY
+					// AND ELAPSED TIME OF THE PROCESS IS 3 SECONDS
+					// THEN I CONSIDER THE ELAPSED TIME AS 15 SECONDS.
+					process->_Report_history(history, elapsed_time * getPerformance(), now);
+				}
 
 				// COMPLETE THE HISTORY IN THE BELONGED SYSTEM_ARRAY
 				((parallel::base::ParallelSystemArrayBase*)system_array_)->_Complete_history(history);
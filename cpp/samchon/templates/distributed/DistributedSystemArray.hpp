@@ -6,6 +6,12 @@
 #	include <samchon/templates/distributed/DistributedProcess.hpp>
 #include <samchon/templates/distributed/base/DistributedSystemArrayBase.hpp>
 
+#include <samchon/templates/distributed/AffinityRouter.hpp>
+#include <samchon/templates/distributed/AffinitySelector.hpp>
+#include <samchon/templates/distributed/LeastWorkSelector.hpp>
+#include <samchon/templates/distributed/PowerOfTwoSelector.hpp>
+#include <samchon/templates/distributed/WeightedQueueSelector.hpp>
+
 namespace samchon
 {
 namespace templates
@@ -133,8 +139,18 @@ namespace distributed
 		DistributedSystemArray()
 			: super()
 		{
+			selector_.reset(new AffinitySelector());
+			affinity_router_.reset(new AffinityRouter());
+		};
+		/**
+		 * Default Destructor.
+		 *
+		 * Stops the executor re-sending processes, before the {@link DistributedProcess} objects are destructed.
+		 */
+		virtual ~DistributedSystemArray()
+		{
+			this->_Get_executor().stop();
 		};
-		virtual ~DistributedSystemArray() = default;
 
 		virtual void construct(std::shared_ptr<library::XML> xml) override
 		{
@@ -167,6 +183,28 @@ namespace distributed
 			super::construct(xml);
 		};
 
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Set selector.
+		 *
+		 * Default is {@link AffinitySelector}. To avoid herd behavior with a lot of concurrent requests, use 
+		 * {@link PowerOfTwoSelector}.
+		 *
+		 * @param selector A {@link SystemSelector} choosing a system in {@link DistributedProcess.sendData}.
+		 */
+		void setSelector(std::shared_ptr<SystemSelector> selector)
+		{
+			std::unique_lock<std::recursive_mutex> uk(this->_Get_state_mutex());
+			selector_ = selector;
+		};
+
+		virtual auto _Get_children() const -> std::vector<std::shared_ptr<external::ExternalSystem>> override
+		{
+			return super::_Get_children();
+		};
+
 	protected:
 		/**
 		 * Factory method creating a child {@link DistributedProcess process} object.
@@ -187,8 +225,6 @@ namespace distributed
 			if (history == nullptr)
 				return super::_Complete_history($history);
 
-			std::unique_lock<std::shared_mutex> uk(getMutex());
-
 			//--------
 			// DistributedProcess's history -> DSInvokeHistory
 			//--------
@@ -196,6 +232,9 @@ namespace distributed
 			if (history->getProcess() == nullptr)
 				return false;
 
+			// LEARN AFFINITY OF THE PAIR
+			affinity_matrix_.observe(history->getProcess(), history->getSystem(), history->computeElapsedTime() / history->getWeight());
+
 			// ESTIMATE PERFORMANCE INDEXES
 			estimate_system_performance(history); // ESTIMATE SYSTEMS' INDEX
 			estimate_process_resource(history); // ESTIMATE PROCESS' PERFORMANCE
@@ -271,10 +310,10 @@ namespace distributed
 
 				// DEDUCT RATIO TO REFLECT THE NEW PERFORMANCE INDEX -> MAXIMUM: 15%
 				double ordinary_ratio;
-				if (process->_Get_history_list().size() < 2)
+				if (process->_Get_history_list().count() < 2)
 					ordinary_ratio = .15;
 				else
-					ordinary_ratio = min(.85, 1.0 / (process->_Get_history_list().size() - 1.0));
+					ordinary_ratio = min(.85, 1.0 / (process->_Get_history_list().count() - 1.0));
 
 				// DEFINE NEW PERFORMANCE
 				process->setResource
@@ -295,9 +334,12 @@ namespace distributed
 			size_t denominator = 0;
 
 			// COMPUTE AVERAGE ELAPSED TIME
-			for (size_t i = 0; i < this->size(); i++)
+			std::shared_ptr<const std::vector<std::shared_ptr<external::ExternalSystem>>> snapshot = this->_Get_snapshot();
+			for (size_t i = 0; i < snapshot->size(); i++)
 			{
-				shared_ptr<DistributedSystem> system = this->at(i);
+				std::shared_ptr<DistributedSystem> system = std::dynamic_pointer_cast<DistributedSystem>(snapshot->at(i));
+				if (system == nullptr)
+					continue;
 
 				double avg = system->_Compute_average_elapsed_time();
 				if (avg == -1)
@@ -321,10 +363,10 @@ namespace distributed
 
 				// DEDUCT RATIO TO REFLECT THE NEW PERFORMANCE INDEX -> MAXIMUM: 30%
 				double ordinary_ratio;
-				if (system->_Get_history_list().size() < 2)
+				if (system->_Get_history_list().count() < 2)
 					ordinary_ratio = .3;
 				else
-					ordinary_ratio = min(0.7, 1.0 / (system->_Get_history_list().size() - 1.0));
+					ordinary_ratio = min(0.7, 1.0 / (system->_Get_history_list().count() - 1.0));
 
 				// DEFINE NEW PERFORMANCE
 				system->setPerformance
@@ -68,9 +68,12 @@ namespace distributed
 		--------------------------------------------------------- */
 		virtual auto _Complete_history(std::shared_ptr<slave::InvokeHistory> history) -> bool override
 		{
+			// PRE-REDUCED RESULT, TO BE REPORTED TO THE MASTER
+			std::shared_ptr<protocol::InvokeParameter> result = this->_Get_reduced_value(history->getUID());
+
 			bool ret = DistributedSystemArray::_Complete_history(history);
 			if (ret == true)
-				getMediator()->_Complete_history(history->getUID());
+				getMediator()->_Complete_history(history->getUID(), result);
 
 			return ret;
 		};
@@ -0,0 +1,38 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/distributed/SystemSelector.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace distributed
+{
+	/**
+	 * A selector of the least outstanding work.
+	 *
+	 * The {@link LeastWorkSelector} selects the {@link DistributedSystem} expected to finish first: the one having the
+	 * least sum of weights of **distributed processes** on progress, including the new one, divided by its
+	 * {@link DistributedSystem.getPerformance performance index}.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class LeastWorkSelector
+		: public SystemSelector
+	{
+	public:
+		virtual ~LeastWorkSelector() = default;
+
+		virtual auto select(const DistributedProcess*, const std::vector<std::shared_ptr<DistributedSystem>> &systems, double weight)
+			-> std::shared_ptr<DistributedSystem> override
+		{
+			return select_min(systems, [weight](const DistributedSystem *system) -> double
+			{
+				return compute_work(system, weight);
+			});
+		};
+	};
+};
+};
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/distributed/SystemSelector.hpp>
+
+#include <mutex>
+#include <random>
+
+namespace samchon
+{
+namespace templates
+{
+namespace distributed
+{
+	/**
+	 * A selector of power of two choices.
+	 *
+	 * The {@link PowerOfTwoSelector} chooses two {@link DistributedSystem} objects randomly and selects the one having
+	 * less outstanding weighted work per {@link DistributedSystem.getPerformance performance index}. Its cost is
+	 * constant regardless of number of systems, and it avoids the herd behavior, many concurrent requests being 
+	 * allocated to a same system which looks the most idle with stale load counters.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class PowerOfTwoSelector
+		: public SystemSelector
+	{
+	private:
+		std::mt19937 engine_;
+		std::mutex mtx_;
+
+	public:
+		/**
+		 * Construct from seed.
+		 *
+		 * @param seed Seed of the random engine.
+		 */
+		PowerOfTwoSelector(unsigned int seed = std::random_device()())
+			: engine_(seed)
+		{
+		};
+		virtual ~PowerOfTwoSelector() = default;
+
+		virtual auto select(const DistributedProcess*, const std::vector<std::shared_ptr<DistributedSystem>> &systems, double weight)
+			-> std::shared_ptr<DistributedSystem> override
+		{
+			if (systems.size() == 1)
+				return systems.front();
+
+			// TWO DIFFERENT CANDIDATES
+			size_t x, y;
+			{
+				std::unique_lock<std::mutex> uk(mtx_);
+
+				x = std::uniform_int_distribution<size_t>(0, systems.size() - 1)(engine_);
+				y = std::uniform_int_distribution<size_t>(0, systems.size() - 2)(engine_);
+			}
+			if (y >= x)
+				y++;
+
+			return select_min({ systems[x], systems[y] }, [weight](const DistributedSystem *system) -> double
+			{
+				return compute_work(system, weight);
+			});
+		};
+	};
+};
+};
+};
@@ -0,0 +1,123 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/distributed/DistributedSystem.hpp>
+
+#include <vector>
+
+namespace samchon
+{
+namespace templates
+{
+namespace distributed
+{
+	class DistributedProcess;
+
+	/**
+	 * An abstract selector of systems.
+	 *
+	 * The {@link SystemSelector} chooses a {@link DistributedSystem} to process a **distributed process**, requested by 
+	 * {@link DistributedProcess.sendData}. Override {@link select} to define a custom selecting strategy and configure
+	 * it with {@link DistributedSystemArray.setSelector}.
+	 *
+	 * The selection is referencing *load counters* of the {@link DistributedSystem} objects, number and sum of weights
+	 * of the **distributed processes** on progress, which are updated atomically. Thus, the selection does not need
+	 * to traverse histories of the systems. Performance indices are throttled by backlogs reported by the slaves;
+	 * tasks of other masters and CPU consumed by other processes.
+	 *
+	 * - {@link AffinitySelector}: least expected time, learned for each pair of process and system.
+	 * - {@link LeastWorkSelector}: least outstanding weighted work per performance.
+	 * - {@link PowerOfTwoSelector}: the better one of two randomly chosen systems.
+	 * - {@link WeightedQueueSelector}: least number of processes on progress per performance.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class SystemSelector
+	{
+	public:
+		/**
+		 * Default Destructor.
+		 */
+		virtual ~SystemSelector() = default;
+
+		/**
+		 * Select a system.
+		 *
+		 * @param process The process requesting.
+		 * @param systems Candidate systems, not {@link DistributedSystem._Is_excluded excluded}. Never empty.
+		 * @param weight Weight of the **distributed process** to allocate.
+		 *
+		 * @return The selected system.
+		 */
+		virtual auto select(const DistributedProcess *process, const std::vector<std::shared_ptr<DistributedSystem>> &systems, double weight)
+			-> std::shared_ptr<DistributedSystem> = 0;
+
+	protected:
+		/**
+		 * Compute effective speed of a system.
+		 *
+		 * @return Performance index of the system, throttled by its {@link DistributedSystem._Compute_availability 
+		 *		   availability} from backlog of the slave. Processes on progress are excluded from the availability, 
+		 *		   because they're counted by the load counters.
+		 */
+		static auto compute_speed(const DistributedSystem *system) -> double
+		{
+			return std::max<double>(system->getPerformance() * system->_Compute_availability(false), 1e-9);
+		};
+
+		/**
+		 * Compute expected work of a system, after allocation.
+		 *
+		 * @return Outstanding weighted work including the new one, divided by {@link compute_speed speed} of the system.
+		 */
+		static auto compute_work(const DistributedSystem *system, double weight) -> double
+		{
+			return (system->_Get_load_weight() + weight) / compute_speed(system);
+		};
+
+		/**
+		 * Compute expected queue length of a system, after allocation.
+		 *
+		 * @return Number of processes on progress including the new one, divided by {@link compute_speed speed} of 
+		 *		   the system.
+		 */
+		static auto compute_queue(const DistributedSystem *system) -> double
+		{
+			return (system->_Get_load_count() + 1.0) / compute_speed(system);
+		};
+
+		/**
+		 * Select the system having the minimum cost.
+		 *
+		 * Ties are broken by greater performance index and then, less histories.
+		 */
+		template <class Cost>
+		static auto select_min(const std::vector<std::shared_ptr<DistributedSystem>> &systems, Cost cost)
+			-> std::shared_ptr<DistributedSystem>
+		{
+			std::shared_ptr<DistributedSystem> best;
+			double best_cost = 0.0;
+
+			for (size_t i = 0; i < systems.size(); i++)
+			{
+				std::shared_ptr<DistributedSystem> system = systems[i];
+				double my_cost = cost(system.get());
+
+				if (best == nullptr
+					|| my_cost < best_cost
+					|| (my_cost == best_cost && system->getPerformance() > best->getPerformance())
+					|| (
+						my_cost == best_cost && system->getPerformance() == best->getPerformance() &&
+						system->_Get_history_list().count() < best->_Get_history_list().count()
+					))
+				{
+					best = system;
+					best_cost = my_cost;
+				}
+			}
+			return best;
+		};
+	};
+};
+};
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/distributed/SystemSelector.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace distributed
+{
+	/**
+	 * A selector of the shortest weighted queue.
+	 *
+	 * The {@link WeightedQueueSelector} selects the {@link DistributedSystem} having the least number of 
+	 * **distributed processes** on progress, divided by its {@link DistributedSystem.getPerformance performance index}.
+	 * Weights of the processes are not considered; use it when the weights are not known.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class WeightedQueueSelector
+		: public SystemSelector
+	{
+	public:
+		virtual ~WeightedQueueSelector() = default;
+
+		virtual auto select(const DistributedProcess*, const std::vector<std::shared_ptr<DistributedSystem>> &systems, double)
+			-> std::shared_ptr<DistributedSystem> override
+		{
+			return select_min(systems, [](const DistributedSystem *system) -> double
+			{
+				return compute_queue(system);
+			});
+		};
+	};
+};
+};
+};
@@ -3,6 +3,7 @@
 
 #include <samchon/HashMap.hpp>
 #include <samchon/templates/distributed/DSInvokeHistory.hpp>
+#include <samchon/templates/slave/HistoryWindow.hpp>
 
 namespace samchon
 {
@@ -26,7 +27,7 @@ namespace base
 
 	private:
 		HashMap<size_t, std::shared_ptr<DSInvokeHistory>> progress_list_;
-		HashMap<size_t, std::shared_ptr<DSInvokeHistory>> history_list_;
+		slave::HistoryWindow<DSInvokeHistory> history_list_;
 
 		double resource;
 		bool enforced_;
@@ -41,11 +42,25 @@ namespace base
 
 		virtual void replyData(std::shared_ptr<protocol::Invoke>) = 0;
 
-		void _Report_history(std::shared_ptr<DSInvokeHistory> history)
+		/**
+		 * @param history The reported history.
+		 * @param elapsedTime Elapsed time of the history, per unit weight and normalized by the system's performance.
+		 * @param now Current time of the system array, to evict expired histories.
+		 */
+		void _Report_history(std::shared_ptr<DSInvokeHistory> history, double elapsedTime, std::chrono::system_clock::time_point now)
 		{
 			// ERASE FROM ORDINARY PROGRESS AND MIGRATE TO THE HISTORY
 			progress_list_.erase(history->getUID());
-			history_list_.emplace(history->getUID(), history);
+			history_list_.insert(history->getUID(), history, elapsedTime, now);
+		};
+
+		/**
+		 * @param uid Unique ID of the cancelled process.
+		 */
+		void _Cancel_history(size_t uid)
+		{
+			// ERASE FROM PROGRESS, WITHOUT ARCHIVING
+			progress_list_.erase(uid);
 		};
 	};
 };
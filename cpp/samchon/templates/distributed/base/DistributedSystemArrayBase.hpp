@@ -3,14 +3,24 @@
 
 #include <samchon/HashMap.hpp>
 #include <samchon/protocol/Entity.hpp>
+#include <samchon/templates/distributed/AffinityMatrix.hpp>
+
+#include <vector>
 
 namespace samchon
 {
 namespace templates
 {
+namespace external
+{
+	class ExternalSystem;
+};
+
 namespace distributed
 {
 	class DistributedProcess;
+	class SystemSelector;
+	class AffinityRouter;
 
 namespace base
 {
@@ -18,11 +28,48 @@ namespace base
 	{
 	protected:
 		HashMap<std::string, std::shared_ptr<DistributedProcess>> process_map_;
+		std::shared_ptr<SystemSelector> selector_;
+		AffinityMatrix affinity_matrix_;
+		std::shared_ptr<AffinityRouter> affinity_router_;
 
 	public:
+		virtual ~DistributedSystemArrayBase() = default;
+
 		/* ---------------------------------------------------------
 			ACCESSORS
 		--------------------------------------------------------- */
+		virtual auto _Get_children() const -> std::vector<std::shared_ptr<external::ExternalSystem>> = 0;
+
+		/**
+		 * Get selector.
+		 *
+		 * @return The {@link SystemSelector} choosing a system in {@link DistributedProcess.sendData}.
+		 */
+		auto getSelector() const -> std::shared_ptr<SystemSelector>
+		{
+			return selector_;
+		};
+
+		/**
+		 * Get affinity router.
+		 *
+		 * @return The {@link AffinityRouter} mapping affinity keys of {@link DistributedProcess.sendData} to systems.
+		 */
+		auto getAffinityRouter() const -> std::shared_ptr<AffinityRouter>
+		{
+			return affinity_router_;
+		};
+
+		/**
+		 * Get affinity matrix.
+		 *
+		 * @return The {@link AffinityMatrix}, elapsed times learned for each pair of process and system.
+		 */
+		auto getAffinityMatrix() const -> const AffinityMatrix&
+		{
+			return affinity_matrix_;
+		};
+
 		/**
 		 * Get process map. 
 		 * 
@@ -77,7 +124,17 @@ namespace base
 		 */
 		void eraseProcess(const std::string &name)
 		{
-			process_map_.erase(name);
+			auto it = process_map_.find(name);
+			if (it == process_map_.end())
+				return;
+
+			affinity_matrix_.erase(it->second.get());
+			process_map_.erase(it);
+		};
+
+		void _Erase_affinity(const DistributedSystem *system)
+		{
+			affinity_matrix_.erase(system);
 		};
 	};
 };
@@ -8,4 +8,6 @@
 #include <samchon/templates/external/ExternalSystem.hpp>
 #	include <samchon/templates/external/ExternalServer.hpp>
 
-#include <samchon/templates/external/ExternalSystemRole.hpp>
\ No newline at end of file
+#include <samchon/templates/external/ExternalSystemRole.hpp>
+#include <samchon/templates/external/BlobStore.hpp>
+#include <samchon/templates/external/ClockEstimator.hpp>
\ No newline at end of file
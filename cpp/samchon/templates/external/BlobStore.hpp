@@ -0,0 +1,182 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/InvokeFrame.hpp>
+
+#include <mutex>
+#include <sstream>
+#include <iomanip>
+#include <boost/uuid/sha1.hpp>
+#include <samchon/HashMap.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace external
+{
+	/**
+	 * A content-addressed store of binary blobs, in the master side.
+	 *
+	 * The {@link BlobStore} keeps large, repeatedly delivered inputs (like a product catalog or a distance matrix)
+	 * and addresses them by hash of their contents. Instead of sending the input with every {@link Invoke} message,
+	 * register it to the {@link BlobStore} once and send only its hash, as a parameter typed ```Blob```.
+	 *
+	 * ```cpp
+	 * std::string hash = system_array->getBlobStore().insert(catalog);
+	 *
+	 * std::shared_ptr<protocol::Invoke> invoke(new protocol::Invoke("optimize"));
+	 * invoke->push_back(BlobStore::createParameter("catalog", hash));
+	 *
+	 * system_array->sendSegmentData(invoke, size);
+	 * ```
+	 *
+	 * When an {@link ExternalSystem} sends an {@link Invoke} message containing ```Blob``` parameters, the blob
+	 * bodies are sent ahead only to the systems not known to hold them. The slave keeps the bodies in its
+	 * {@link slave::BlobCache} and replaces the ```Blob``` parameters with the ```ByteArray``` bodies, so that
+	 * {@link slave::SlaveSystem.replyData} receives ordinary ```ByteArray``` parameters. If the slave has evicted a
+	 * blob, it fetches the body from this {@link BlobStore} again.
+	 *
+	 * @see {@link ExternalSystemArray.getBlobStore}, {@link slave::BlobCache}
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class BlobStore
+	{
+	private:
+		HashMap<std::string, std::shared_ptr<const protocol::InvokeFrame>> frames_;
+		mutable std::mutex mtx_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor.
+		 */
+		BlobStore()
+		{
+		};
+
+		/* ---------------------------------------------------------
+			ELEMENTS I/O
+		--------------------------------------------------------- */
+		/**
+		 * Register a blob.
+		 *
+		 * @param data Contents of the blob.
+		 * @return Hash of the *data*, address of the blob.
+		 */
+		auto insert(const ByteArray &data) -> std::string
+		{
+			return insert(ByteArray(data));
+		};
+
+		/**
+		 * Register a blob with move.
+		 *
+		 * @param data Contents of the blob.
+		 * @return Hash of the *data*, address of the blob.
+		 */
+		auto insert(ByteArray &&data) -> std::string
+		{
+			std::string key = hash(data);
+
+			std::unique_lock<std::mutex> uk(mtx_);
+			if (frames_.has(key) == false)
+			{
+				// PRE-SERIALIZED MESSAGE DELIVERING THE BODY
+				std::shared_ptr<protocol::Invoke> invoke(new protocol::Invoke("_Store_blob", key));
+				invoke->emplace_back(new protocol::InvokeParameter("data", move(data)));
+
+				frames_.insert({ key, std::make_shared<protocol::InvokeFrame>(invoke) });
+			}
+			return key;
+		};
+
+		/**
+		 * Erase a blob.
+		 *
+		 * Slaves fetching the blob after the erasing cannot get its body.
+		 *
+		 * @param key Hash of the blob to erase.
+		 */
+		void erase(const std::string &key)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			frames_.erase(key);
+		};
+
+		/**
+		 * Test whether a blob is registered.
+		 *
+		 * @param key Hash of the blob.
+		 */
+		auto has(const std::string &key) const -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return frames_.has(key);
+		};
+
+		/**
+		 * Get number of registered blobs.
+		 */
+		auto size() const -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return frames_.size();
+		};
+
+		/**
+		 * @hidden
+		 */
+		auto _Get_frame(const std::string &key) const -> std::shared_ptr<const protocol::InvokeFrame>
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = frames_.find(key);
+			if (it == frames_.end())
+				return nullptr;
+			else
+				return it->second;
+		};
+
+		/* ---------------------------------------------------------
+			STATIC FUNCTIONS
+		--------------------------------------------------------- */
+		/**
+		 * Create a ```Blob``` parameter.
+		 *
+		 * @param name Name of the parameter.
+		 * @param key Hash of the blob, returned from {@link insert}.
+		 */
+		static auto createParameter(const std::string &name, const std::string &key) -> std::shared_ptr<protocol::InvokeParameter>
+		{
+			return std::make_shared<protocol::InvokeParameter>(name, "Blob", key);
+		};
+
+		/**
+		 * Compute hash of contents.
+		 *
+		 * @param data Contents of a blob.
+		 * @return SHA-1 digest in hexadecimal, with size of the *data*.
+		 */
+		static auto hash(const ByteArray &data) -> std::string
+		{
+			boost::uuids::detail::sha1 sha1;
+			sha1.process_bytes(data.data(), data.size());
+
+			unsigned int digest[5];
+			sha1.get_digest(digest);
+
+			std::stringstream ss;
+			ss << std::hex << std::setfill('0');
+			for (size_t i = 0; i < 5; i++)
+				ss << std::setw(8) << digest[i];
+			ss << "-" << std::dec << data.size();
+
+			return ss.str();
+		};
+	};
+};
+};
+};
@@ -0,0 +1,271 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <algorithm>
+
+namespace samchon
+{
+namespace templates
+{
+namespace external
+{
+	/**
+	 * An estimator of clock offset and round trip time, of an external system.
+	 *
+	 * The {@link ClockEstimator} estimates how much the remote system's clock is ahead of this system's and how long
+	 * a message takes to go and return, by pings as NTP does. An {@link ExternalSystem} sends a ```_Ping``` with a
+	 * sequence number, then the remote system replies a ```_Pong``` at once with time it has received the ping, in its
+	 * clock, and time it has held the ping. With time of sending and receiving in this system:
+	 *
+	 * ```
+	 * round trip time = (t3 - t0) - held
+	 * offset = t1 + held / 2 - (t0 + t3) / 2
+	 * ```
+	 *
+	 * The round trip time is measured by the steady clock, thus does not suffer from skews or jumps of the system
+	 * clocks. Among the recent samples, the one having the least round trip time wins; delays of queues on the way
+	 * only increase the round trip time and spoil the offset.
+	 *
+	 * @see {@link ExternalSystem.ping}, {@link CostModel.getLatency}
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class ClockEstimator
+	{
+	private:
+		struct Sample
+		{
+			std::chrono::microseconds round_trip;
+			std::chrono::microseconds offset;
+		};
+
+		// PINGS WAITING FOR THEIR PONGS; SEQ -> (SYSTEM CLOCK, STEADY CLOCK)
+		std::map<size_t, std::pair<std::chrono::system_clock::time_point, std::chrono::steady_clock::time_point>> pings_;
+		size_t sequence_{ 0 };
+
+		std::deque<Sample> samples_;
+		size_t window_;
+
+		std::chrono::steady_clock::time_point pinged_at_;
+		std::chrono::steady_clock::duration interval_;
+
+		mutable std::mutex mtx_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor.
+		 */
+		ClockEstimator()
+		{
+			window_ = 8;
+			interval_ = std::chrono::seconds(1);
+		};
+
+		/**
+		 * Copy Constructor.
+		 */
+		ClockEstimator(const ClockEstimator &obj)
+		{
+			std::unique_lock<std::mutex> uk(obj.mtx_);
+
+			samples_ = obj.samples_;
+			window_ = obj.window_;
+			interval_ = obj.interval_;
+		};
+
+		/**
+		 * Clear the samples and the pings waiting.
+		 */
+		void clear()
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			pings_.clear();
+			samples_.clear();
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Whether any sample has been taken.
+		 */
+		auto isEstimated() const -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return samples_.empty() == false;
+		};
+
+		/**
+		 * Get estimated offset.
+		 *
+		 * @return Time the remote system's clock is ahead of this system's, ```0``` if not estimated.
+		 */
+		auto getOffset() const -> std::chrono::microseconds
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = _Best();
+			return (it == samples_.end()) ? std::chrono::microseconds::zero() : it->offset;
+		};
+
+		/**
+		 * Get estimated round trip time.
+		 *
+		 * The least round trip time of the recent samples; time of the network, both ways, excluding the remote
+		 * system's handling.
+		 *
+		 * @return The round trip time, ```0``` if not estimated.
+		 */
+		auto getRoundTrip() const -> std::chrono::microseconds
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = _Best();
+			return (it == samples_.end()) ? std::chrono::microseconds::zero() : it->round_trip;
+		};
+
+		/**
+		 * Get window, number of the recent samples to keep.
+		 */
+		auto getWindow() const -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return window_;
+		};
+		void setWindow(size_t val)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			window_ = std::max<size_t>(val, 1);
+
+			while (samples_.size() > window_)
+				samples_.pop_front();
+		};
+
+		/**
+		 * Get interval of the periodic pings.
+		 */
+		auto getInterval() const -> std::chrono::steady_clock::duration
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return interval_;
+		};
+		void setInterval(std::chrono::steady_clock::duration val)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			interval_ = val;
+		};
+
+		/* ---------------------------------------------------------
+			PING & PONG
+		--------------------------------------------------------- */
+		/**
+		 * Whether a periodic ping is due.
+		 *
+		 * A ping waiting for its pong more than a few intervals is considered as lost, thus does not hold next pings.
+		 *
+		 * @param now Current time of the steady clock.
+		 */
+		auto _Is_due(std::chrono::steady_clock::time_point now) const -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			for (auto it = pings_.begin(); it != pings_.end(); it++)
+				if (now - it->second.second < _Deadline())
+					return false;
+
+			return samples_.empty() == true || now - pinged_at_ >= interval_;
+		};
+
+		/**
+		 * Issue a ping.
+		 *
+		 * @param now Current time of the system clock.
+		 * @param steady Current time of the steady clock.
+		 * @return Sequence number of the ping.
+		 */
+		auto _Issue(std::chrono::system_clock::time_point now, std::chrono::steady_clock::time_point steady) -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			// PONGS MAY BE LOST; FORGET THE EXPIRED PINGS AND THE OLDEST ONES
+			for (auto it = pings_.begin(); it != pings_.end(); )
+				if (steady - it->second.second >= _Deadline())
+					it = pings_.erase(it);
+				else
+					it++;
+
+			size_t seq = ++sequence_;
+			pings_.emplace(seq, std::make_pair(now, steady));
+			pinged_at_ = steady;
+
+			while (pings_.size() > window_)
+				pings_.erase(pings_.begin());
+
+			return seq;
+		};
+
+		/**
+		 * Settle a ping with its pong.
+		 *
+		 * @param seq Sequence number of the ping.
+		 * @param now Current time of the system clock.
+		 * @param steady Current time of the steady clock.
+		 * @param received Time the remote system has received the ping, microseconds since epoch of its clock.
+		 * @param held Time the remote system has held the ping, in nanoseconds.
+		 * @return Whether the ping has been waiting for the pong.
+		 */
+		auto _Settle(size_t seq, std::chrono::system_clock::time_point now, std::chrono::steady_clock::time_point steady, long long received, long long held) -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = pings_.find(seq);
+			if (it == pings_.end())
+				return false;
+
+			std::chrono::system_clock::time_point sent = it->second.first;
+			std::chrono::steady_clock::time_point steady_sent = it->second.second;
+			pings_.erase(it);
+
+			std::chrono::nanoseconds hold(std::max<long long>(held, 0));
+			std::chrono::nanoseconds round_trip = std::max<std::chrono::nanoseconds>
+			(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(steady - steady_sent) - hold,
+				std::chrono::nanoseconds::zero()
+			);
+
+			// MIDPOINT OF THE REMOTE'S HOLDING, MINUS MIDPOINT OF THE ROUND TRIP IN THIS SYSTEM
+			long long t0 = std::chrono::duration_cast<std::chrono::microseconds>(sent.time_since_epoch()).count();
+			long long t3 = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+			long long offset = received + hold.count() / 2000 - (t0 + (t3 - t0) / 2);
+
+			samples_.push_back({ std::chrono::duration_cast<std::chrono::microseconds>(round_trip), std::chrono::microseconds(offset) });
+			while (samples_.size() > window_)
+				samples_.pop_front();
+
+			return true;
+		};
+
+	private:
+		auto _Deadline() const -> std::chrono::steady_clock::duration
+		{
+			return interval_ * 4;
+		};
+
+		auto _Best() const -> std::deque<Sample>::const_iterator
+		{
+			return std::min_element(samples_.begin(), samples_.end(), [](const Sample &x, const Sample &y) -> bool
+			{
+				return x.round_trip < y.round_trip;
+			});
+		};
+	};
+};
+};
+};
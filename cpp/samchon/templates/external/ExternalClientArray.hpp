@@ -59,31 +59,24 @@ namespace external
 		 * 
 		 * When a {@link ClientDriver remote client} connects to this *server* {@link ExternalClientArray} object, 
 		 * then this {@link ExternalClientArray} creates a child {@link ExternalSystem external client} object through 
-		 * the {@link createExternalClient createExternalClient()} method and {@link insert inserts} it.
+		 * the {@link createExternalClient createExternalClient()} method and {@link join joins} it. When the client 
+		 * disconnects, the child {@link leave leaves}.
 		 * 
 		 * @param driver A communicator for external client.
 		 */
-		virtual void addClient(std::shared_ptr<protocol::ClientDriver> driver) override final
+		virtual void addClient(std::shared_ptr<protocol::ClientDriver> driver) override
 		{
-			std::shared_ptr<ExternalSystem> system(createExternalClient(driver));
+			std::shared_ptr<System> system(createExternalClient(driver));
 			if (system == nullptr)
 				return;
 
 			system->communicator_ = driver;
-			{
-				library::UniqueWriteLock uk(getMutex());
-				push_back(system);
-			}
-			driver->listen(system.get());
+			this->join(system);
 
-			for (size_t i = 0; i < size(); i++)
-				if (at(i) == system)
-				{
-					library::UniqueWriteLock uk(getMutex());
+			driver->listen(system.get());
 
-					erase(begin() + i);
-					break;
-				}
+			// DISCONNECTED
+			this->leave(system);
 		};
 
 		/**
@@ -6,6 +6,9 @@
 
 #include <samchon/protocol/ServerConnector.hpp>
 
+#include <chrono>
+#include <functional>
+
 namespace samchon
 {
 namespace templates
@@ -71,27 +74,58 @@ namespace external
 		--------------------------------------------------------- */
 		/**
 		 * Connect to external server.
+		 *
+		 * Blocks until disconnected, then erases this object from the parent {@link ExternalSystemArray}.
+		 *
+		 * @throw boost::system::system_error If failed to connect.
 		 */
 		virtual void connect()
 		{
 			if (communicator_ != nullptr || ip.empty() == true)
 				return;
 
-			// CREATE CONNECTOR AND CONNECT
-			std::shared_ptr<protocol::ServerConnector> connector(this->createServerConnector());
-			this->communicator_ = connector;
-
-			connector->connect(ip, port);
+			_Connect(std::chrono::steady_clock::duration::zero(), nullptr);
 
 			// AFTER DISCONNECTION, ERASE THIS OBJECT
+			std::unique_lock<std::shared_mutex> uk(system_array_->getMutex());
+
 			protocol::SharedEntityDeque<ExternalSystem> *systemArray = (protocol::SharedEntityDeque<ExternalSystem>*)system_array_;
 			for (size_t i = 0; i < systemArray->size(); i++)
 				if (systemArray->at(i).get() == this)
 				{
 					systemArray->erase(systemArray->begin() + i);
+					system_array_->_Publish_snapshot();
 					break;
 				}
 		};
+
+		/**
+		 * @hidden
+		 *
+		 * Connect and listen until disconnected.
+		 *
+		 * The connector becomes the communicator only when connected, not to send messages to a socket still
+		 * connecting. Unlike {@link connect connect()}, this object stays in its parent, and can connect again.
+		 *
+		 * @param timeout Deadline of connecting. Zero means the TCP timeout of the system.
+		 * @param connected A function called when connected, before listening.
+		 * @throw boost::system::system_error If failed to connect.
+		 */
+		void _Connect(std::chrono::steady_clock::duration timeout, std::function<void()> connected)
+		{
+			std::shared_ptr<protocol::ServerConnector> connector(this->createServerConnector());
+			connector->setTimeout(timeout);
+			connector->onConnect = [this, &connector, connected]()
+			{
+				// PINGS OF THE LAST CONNECTION NEVER GET THEIR PONGS, AND THE NETWORK MAY DIFFER
+				this->getClockEstimator().clear();
+				this->communicator_ = connector;
+				if (connected != nullptr)
+					connected();
+			};
+
+			connector->connect(ip, port);
+		};
 	};
 };
 };
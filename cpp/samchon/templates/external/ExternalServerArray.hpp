@@ -5,6 +5,10 @@
 #	include <samchon/templates/external/ExternalServer.hpp>
 
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
 
 namespace samchon
 {
@@ -29,6 +33,26 @@ namespace external
 	class ExternalServerArray
 		: public virtual ExternalSystemArray<System>
 	{
+	private:
+		// PROGRESS OF A CALL OF CONNECT(), BY THE FIRST ATTEMPTS
+		struct Round
+		{
+			size_t total;
+			size_t connected;
+			size_t settled;
+		};
+
+		// THREADS CONNECTING AND LISTENING TO THE SERVERS, BY THEIR ROUNDS
+		std::vector<std::pair<std::shared_ptr<Round>, std::thread>> connectors_;
+
+		// SERVERS HAVING THEIR CONNECTORS RUNNING, AND THE SERVERS CONNECTED
+		std::vector<std::shared_ptr<ExternalServer>> running_;
+		std::vector<std::shared_ptr<ExternalServer>> online_;
+		bool stopping_{ false };
+
+		std::mutex connect_mtx_;
+		std::condition_variable connect_cv_;
+
 	public:
 		/**
 		 * Default Constructor.
@@ -37,28 +61,229 @@ namespace external
 			: ExternalSystemArray<System>()
 		{
 		};
-		virtual ~ExternalServerArray() = default;
+
+		/**
+		 * Destructor.
+		 *
+		 * Closes the connections and waits for the threads connecting; each one ends within its timeout.
+		 */
+		virtual ~ExternalServerArray()
+		{
+			_Stop_connectors();
+		};
 
 		/**
 		 * Connect to {@link ExternalServer external servers}.
 		 * 
-		 * This method calls children elements' method {@link ExternalServer.connect} gradually.
+		 * This method calls children elements' method {@link ExternalServer.connect} gradually. Blocks until all the 
+		 * servers have disconnected or failed to connect. Servers already connecting by a former call are left to it.
 		 */
 		virtual void connect()
 		{
-			std::vector<std::thread> thread_array;
+			std::shared_ptr<Round> round = _Start_connectors(std::chrono::steady_clock::duration::zero(), std::chrono::steady_clock::duration::zero());
+
+			// WITHOUT RETRY, THE THREADS END WHEN THEIR SERVERS HAVE DISCONNECTED; WAIT ONLY FOR THE THREADS OF THIS CALL
+			std::vector<std::thread> connectors;
+			{
+				std::unique_lock<std::mutex> uk(connect_mtx_);
+
+				for (size_t i = 0; i < connectors_.size();)
+					if (connectors_[i].first == round)
+					{
+						connectors.push_back(std::move(connectors_[i].second));
+						connectors_.erase(connectors_.begin() + i);
+					}
+					else
+						i++;
+			}
+
+			for (size_t i = 0; i < connectors.size(); i++)
+				connectors[i].join();
+		};
+
+		/**
+		 * Connect to {@link ExternalServer external servers}, with a quorum.
+		 *
+		 * Connects to the servers, which have been inserted in advance, in parallel. The servers leave this array at 
+		 * first; each one {@link join joins} as soon as it has connected and {@link leave leaves} when disconnected. 
+		 * Servers already connecting by a former call are left to it, thus calling again connects only the servers 
+		 * inserted meanwhile. 
+		 * Returns when *quorum* of them have connected or all the first attempts have ended, thus this array can start 
+		 * with the quorum while late servers join as they come up.
+		 *
+		 * Connecting to an unreachable host fails after the *timeout*, not blocking the others. Servers failed or 
+		 * disconnected are connected again after the *retry* interval, until this array is destructed.
+		 *
+		 * @param quorum Number of servers to wait for. If it exceeds the number of servers, waits for all of them.
+		 * @param timeout Deadline of each attempt to connect. Zero means the TCP timeout of the system.
+		 * @param retry Interval between attempts to a server. Zero means no retry; a server failed or disconnected is 
+		 *				given up.
+		 *
+		 * @return Number of servers connected by their first attempts, until returned.
+		 */
+		virtual auto connect(size_t quorum, std::chrono::steady_clock::duration timeout, std::chrono::steady_clock::duration retry = std::chrono::seconds(1)) -> size_t
+		{
+			std::shared_ptr<Round> round = _Start_connectors(timeout, retry);
+			quorum = std::min(quorum, round->total);
+
+			std::unique_lock<std::mutex> uk(connect_mtx_);
+			connect_cv_.wait(uk, [this, &round, quorum]() -> bool
+			{
+				return stopping_ == true || round->connected >= quorum || round->settled == round->total;
+			});
+			return round->connected;
+		};
+
+	private:
+		auto _Start_connectors(std::chrono::steady_clock::duration timeout, std::chrono::steady_clock::duration retry) -> std::shared_ptr<Round>
+		{
+			std::vector<std::pair<std::shared_ptr<System>, std::shared_ptr<ExternalServer>>> servers;
+			{
+				// THE SERVERS HAVE BEEN INSERTED IN ADVANCE; THEY JOIN AGAIN WHEN CONNECTED
+				std::unique_lock<std::shared_mutex> uk(getMutex());
+				std::unique_lock<std::mutex> ck(connect_mtx_);
+
+				for (size_t i = 0; i < size();)
+				{
+					// SERVERS CONNECTING BY A FORMER CALL STAY
+					std::shared_ptr<ExternalServer> external_server = std::dynamic_pointer_cast<ExternalServer>(this->at(i));
+					if (external_server == nullptr 
+						|| std::find(running_.begin(), running_.end(), external_server) != running_.end())
+					{
+						i++;
+						continue;
+					}
+
+					servers.emplace_back(this->at(i), external_server);
+					running_.push_back(external_server);
+
+					this->erase(begin() + i);
+				}
+			}
+
+			std::shared_ptr<Round> round(new Round{ servers.size(), 0, 0 });
+
+			std::unique_lock<std::mutex> uk(connect_mtx_);
+			for (size_t i = 0; i < servers.size(); i++)
+			{
+				// HOLD THE SERVER, WHICH MAY LEAVE WHILE CONNECTED
+				std::shared_ptr<System> system = servers[i].first;
+				std::shared_ptr<ExternalServer> external_server = servers[i].second;
+
+				connectors_.emplace_back(round, std::thread([this, system, external_server, timeout, retry, round]()
+				{
+					_Run_connector(system, external_server, timeout, retry, round);
+				}));
+			}
+			return round;
+		};
+
+		void _Run_connector(std::shared_ptr<System> system, std::shared_ptr<ExternalServer> external_server, std::chrono::steady_clock::duration timeout, std::chrono::steady_clock::duration retry, std::shared_ptr<Round> round)
+		{
+			bool first = true;
+			while (true)
+			{
+				bool joined = false;
+				try
+				{
+					external_server->_Connect(timeout, [&]()
+					{
+						{
+							std::unique_lock<std::mutex> uk(connect_mtx_);
+							if (stopping_ == true)
+							{
+								external_server->close();
+								return;
+							}
+						}
+
+						// JOIN WITHOUT THE CONNECT_MTX_, WHICH THE MEMBERSHIP DOES NOT NEED
+						this->join(system);
+
+						std::unique_lock<std::mutex> uk(connect_mtx_);
+						online_.push_back(external_server);
+						joined = true;
+
+						// STOPPED WHILE JOINING
+						if (stopping_ == true)
+							external_server->close();
+
+						if (first == true)
+						{
+							round->connected++;
+							round->settled++;
+							first = false;
 
-			for (size_t i = 0; i < size(); i++)
+							connect_cv_.notify_all();
+						}
+					});
+				}
+				catch (...)
+				{
+					// FAILED TO CONNECT; AN UNREACHABLE HOST OR THE TIMEOUT
+				}
+
+				if (joined == true)
+				{
+					// DISCONNECTED
+					bool leaving;
+					{
+						std::unique_lock<std::mutex> uk(connect_mtx_);
+
+						online_.erase(std::remove(online_.begin(), online_.end(), external_server), online_.end());
+						leaving = (stopping_ == false);
+					}
+					if (leaving == true)
+						this->leave(system);
+				}
+
+				std::unique_lock<std::mutex> uk(connect_mtx_);
+				if (first == true)
+				{
+					round->settled++;
+					first = false;
+
+					connect_cv_.notify_all();
+				}
+
+				// TRY AGAIN, AFTER THE INTERVAL
+				if (retry <= std::chrono::steady_clock::duration::zero() 
+					|| connect_cv_.wait_for(uk, retry, [this]() { return stopping_; }) == true)
+				{
+					// GIVEN UP; THE SERVER CAN BE CONNECTED BY ANOTHER CALL
+					running_.erase(std::remove(running_.begin(), running_.end(), external_server), running_.end());
+					break;
+				}
+			}
+		};
+
+	public:
+		/**
+		 * @hidden
+		 *
+		 * Stop connecting, close the connections and wait for the threads.
+		 */
+		void _Stop_connectors()
+		{
+			std::vector<std::pair<std::shared_ptr<Round>, std::thread>> connectors;
 			{
-				auto external_server = std::dynamic_pointer_cast<ExternalServer>(this->at(i));
-				if (external_server == nullptr)
-					continue;
+				std::unique_lock<std::mutex> uk(connect_mtx_);
+				if (connectors_.empty() == true && online_.empty() == true)
+					return;
+
+				stopping_ = true;
+				for (size_t i = 0; i < online_.size(); i++)
+					online_[i]->close();
 
-				thread_array.emplace_back(&ExternalServer::connect, external_server.get());
+				connectors_.swap(connectors);
+				connect_cv_.notify_all();
 			}
 
-			for (size_t i = 0; i < thread_array.size(); i++)
-				thread_array[i].join();
+			for (size_t i = 0; i < connectors.size(); i++)
+				connectors[i].second.join();
+
+			std::unique_lock<std::mutex> uk(connect_mtx_);
+			stopping_ = false;
 		};
 	};
 };
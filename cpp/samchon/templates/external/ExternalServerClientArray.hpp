@@ -51,9 +51,15 @@ namespace external
 		};
 
 		/**
-		 * @brief Default Destructor.
+		 * @brief Destructor.
+		 *
+		 * Stops connecting to the servers before the sibling bases, like {@link ParallelSystemArray}, are destructed;
+		 * the {@link ExternalServerArray} is a virtual base, destructed last.
 		 */
-		virtual ~ExternalServerClientArray() = default;
+		virtual ~ExternalServerClientArray()
+		{
+			this->_Stop_connectors();
+		};
 
 	protected:
 		/* ---------------------------------------------------------
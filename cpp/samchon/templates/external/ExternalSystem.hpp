@@ -4,6 +4,7 @@
 #include <samchon/protocol/SharedEntityDeque.hpp>
 #	include <samchon/templates/external/ExternalSystemRole.hpp>
 #include <samchon/templates/external/base/ExternalSystemBase.hpp>
+#include <samchon/templates/external/ClockEstimator.hpp>
 #include <samchon/protocol/IProtocol.hpp>
 
 #include <samchon/templates/external/base/ExternalSystemArrayBase.hpp>
@@ -11,6 +12,9 @@
 
 #include <samchon/protocol/ClientDriver.hpp>
 
+#include <mutex>
+#include <unordered_set>
+
 namespace samchon
 {
 namespace templates
@@ -68,6 +72,12 @@ namespace external
 		 */
 		std::string name;
 
+	private:
+		std::unordered_set<std::string> blobs_;
+		std::mutex blob_mtx_;
+
+		ClockEstimator clock_estimator_;
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -100,6 +110,7 @@ namespace external
 		 */
 		ExternalSystem(base::ExternalSystemArrayBase *systemArray, std::shared_ptr<protocol::ClientDriver> driver)
 		{
+			this->system_array_ = systemArray;
 			this->communicator_ = driver;
 		};
 
@@ -148,6 +159,20 @@ namespace external
 			return name;
 		};
 
+		/**
+		 * Get the {@link ClockEstimator}.
+		 *
+		 * Offset of the remote system's clock and round trip time to it, estimated by {@link ping pings}.
+		 */
+		auto getClockEstimator() -> ClockEstimator&
+		{
+			return clock_estimator_;
+		};
+		auto getClockEstimator() const -> const ClockEstimator&
+		{
+			return clock_estimator_;
+		};
+
 	public:
 		/* ---------------------------------------------------------
 			NETWORK & MESSAGE CHAIN
@@ -167,9 +192,25 @@ namespace external
 		 */
 		virtual void sendData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
+			_Send_blobs(invoke, false);
+
 			communicator_->sendData(invoke);
 		};
 
+		/**
+		 * Send a serialized {@link Invoke} message to external system.
+		 * 
+		 * Enqueues the {@link InvokeFrame} to the asynchronous writer of the communicator and returns immediately.
+		 * 
+		 * @param frame A serialized {@link Invoke} message to send.
+		 */
+		virtual void sendFrame(std::shared_ptr<const protocol::InvokeFrame> frame)
+		{
+			_Send_blobs(frame->getInvoke(), true);
+
+			communicator_->postFrame(frame);
+		};
+
 		/**
 		 * Handle an {@Invoke} message has received.
 		 * 
@@ -177,6 +218,12 @@ namespace external
 		 */
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
+			if (invoke->getListener() == "_Pong")
+			{
+				_Receive_pong(invoke, std::chrono::system_clock::now(), std::chrono::steady_clock::now());
+				return;
+			}
+
 			// SHIFT TO ROLES
 			for (size_t i = 0; i < size(); i++)
 				at(i)->replyData(invoke);
@@ -185,6 +232,108 @@ namespace external
 			((IProtocol*)system_array_)->replyData(invoke);
 		};
 
+		/**
+		 * Ping the remote system.
+		 *
+		 * Sends a ```_Ping``` message. The remote system, a {@link SlaveSystem}, replies a ```_Pong``` at once, and 
+		 * then the {@link getClockEstimator clock estimator} takes a sample of the offset and round trip time.
+		 */
+		virtual void ping()
+		{
+			_Ping(std::chrono::system_clock::now(), std::chrono::steady_clock::now());
+		};
+
+	protected:
+		/**
+		 * Send a ```_Ping``` message.
+		 *
+		 * @param now Current time of the system clock.
+		 * @param steady Current time of the steady clock.
+		 */
+		void _Ping(std::chrono::system_clock::time_point now, std::chrono::steady_clock::time_point steady)
+		{
+			size_t seq = clock_estimator_._Issue(now, steady);
+			sendData(std::make_shared<protocol::Invoke>("_Ping", seq));
+		};
+
+		/**
+		 * Handle a ```_Pong``` message.
+		 *
+		 * @param invoke The ```_Pong``` message; sequence number, time received and time held by the remote system.
+		 * @param now Current time of the system clock.
+		 * @param steady Current time of the steady clock.
+		 */
+		void _Receive_pong(std::shared_ptr<protocol::Invoke> invoke, std::chrono::system_clock::time_point now, std::chrono::steady_clock::time_point steady)
+		{
+			clock_estimator_._Settle
+			(
+				invoke->at(0)->getValue<size_t>(), now, steady, 
+				invoke->at(1)->getValue<long long>(), invoke->at(2)->getValue<long long>()
+			);
+		};
+
+		/**
+		 * Send bodies of blobs the remote system may not hold.
+		 *
+		 * For each ```Blob``` parameter in the *invoke*, sends the body registered in the {@link BlobStore} ahead of the
+		 * *invoke*, if the remote system is not known to hold it.
+		 *
+		 * @param invoke An {@link Invoke} message to be sent.
+		 * @param async Whether to send through the asynchronous writer or not.
+		 */
+		void _Send_blobs(std::shared_ptr<protocol::Invoke> invoke, bool async)
+		{
+			if (system_array_ == nullptr)
+				return;
+
+			for (size_t i = 0; i < invoke->size(); i++)
+			{
+				const std::shared_ptr<protocol::InvokeParameter> &parameter = invoke->at(i);
+				if (parameter->getType() != "Blob")
+					continue;
+
+				const std::string &key = parameter->referValue<std::string>();
+				{
+					std::unique_lock<std::mutex> uk(blob_mtx_);
+					if (blobs_.insert(key).second == false)
+						continue; // ALREADY HOLDING
+				}
+				_Send_blob(key, async);
+			}
+		};
+
+		/**
+		 * Send body of a blob.
+		 *
+		 * Also called when the remote system fetches a blob it has evicted. If the blob is not registered in the 
+		 * {@link BlobStore}, the body is omitted and the remote system gives up the blob.
+		 *
+		 * @param key Hash of the blob.
+		 * @param async Whether to send through the asynchronous writer or not.
+		 */
+		void _Send_blob(const std::string &key, bool async)
+		{
+			std::shared_ptr<const protocol::InvokeFrame> frame = system_array_->getBlobStore()._Get_frame(key);
+			if (frame == nullptr)
+			{
+				{
+					std::unique_lock<std::mutex> uk(blob_mtx_);
+					blobs_.erase(key);
+				}
+				frame.reset(new protocol::InvokeFrame(std::make_shared<protocol::Invoke>("_Store_blob", key)));
+			}
+			else
+			{
+				std::unique_lock<std::mutex> uk(blob_mtx_);
+				blobs_.insert(key);
+			}
+
+			if (async)
+				communicator_->postFrame(frame);
+			else
+				communicator_->sendFrame(frame);
+		};
+
 	public:
 		/* ---------------------------------------------------------
 			EXPORTERS
@@ -8,6 +8,8 @@
 
 #include <vector>
 #include <thread>
+#include <shared_mutex>
+#include <samchon/protocol/InvokeFrame.hpp>
 
 namespace samchon
 {
@@ -89,6 +91,22 @@ namespace external
 		 * Default Destructor.
 		 */
 		virtual ~ExternalSystemArray() = default;
+
+		/**
+		 * Construct children systems from XML.
+		 *
+		 * Locks the {@link getMutex membership} uniquely and publishes the {@link _Get_snapshot snapshot} after 
+		 * construction.
+		 *
+		 * @param xml {@link XML} represents the children systems.
+		 */
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			std::unique_lock<std::shared_mutex> uk(getMutex());
+
+			super::construct(xml);
+			_Publish_snapshot();
+		};
 		
 	public:
 		/* ---------------------------------------------------------
@@ -134,26 +152,164 @@ namespace external
 			return children;
 		};
 
+		/* ---------------------------------------------------------
+			MUTATORS
+		--------------------------------------------------------- */
+		/**
+		 * Insert a system at the end.
+		 *
+		 * Mutators of the {@link ExternalSystemArray} publish the {@link _Get_snapshot snapshot} by themselves, thus
+		 * readers never miss a change of the membership. Call them with {@link getMutex} locked uniquely.
+		 */
+		template <class... Args>
+		void push_back(Args&&... args)
+		{
+			super::push_back(std::forward<Args>(args)...);
+			_Publish_snapshot();
+		};
+		template <class... Args>
+		void push_front(Args&&... args)
+		{
+			super::push_front(std::forward<Args>(args)...);
+			_Publish_snapshot();
+		};
+		template <class... Args>
+		void emplace_back(Args&&... args)
+		{
+			super::emplace_back(std::forward<Args>(args)...);
+			_Publish_snapshot();
+		};
+		template <class... Args>
+		void emplace_front(Args&&... args)
+		{
+			super::emplace_front(std::forward<Args>(args)...);
+			_Publish_snapshot();
+		};
+		template <class... Args>
+		auto emplace(Args&&... args) -> typename super::iterator
+		{
+			typename super::iterator it = super::emplace(std::forward<Args>(args)...);
+			_Publish_snapshot();
+
+			return it;
+		};
+		template <class... Args>
+		auto insert(Args&&... args) -> typename super::iterator
+		{
+			typename super::iterator it = super::insert(std::forward<Args>(args)...);
+			_Publish_snapshot();
+
+			return it;
+		};
+		auto erase(typename super::const_iterator position) -> typename super::iterator
+		{
+			typename super::iterator it = super::erase(position);
+			_Publish_snapshot();
+
+			return it;
+		};
+		auto erase(typename super::const_iterator first, typename super::const_iterator last) -> typename super::iterator
+		{
+			typename super::iterator it = super::erase(first, last);
+			_Publish_snapshot();
+
+			return it;
+		};
+		void erase(const typename System::key_type &key)
+		{
+			super::erase(key);
+			_Publish_snapshot();
+		};
+		void pop_back()
+		{
+			super::pop_back();
+			_Publish_snapshot();
+		};
+		void pop_front()
+		{
+			super::pop_front();
+			_Publish_snapshot();
+		};
+		void clear()
+		{
+			super::clear();
+			_Publish_snapshot();
+		};
+
+		/* ---------------------------------------------------------
+			MEMBERSHIP
+		--------------------------------------------------------- */
+		/**
+		 * Join a system.
+		 *
+		 * Inserts the system, which has been constructed with this array as its parent, and publishes the 
+		 * {@link _Get_snapshot snapshot}. Safe while other threads are sending messages; they see the system from 
+		 * their next sending.
+		 *
+		 * @param system A system to join.
+		 */
+		virtual void join(std::shared_ptr<System> system)
+		{
+			std::unique_lock<std::shared_mutex> uk(getMutex());
+
+			this->push_back(system);
+		};
+
+		/**
+		 * Drain a system.
+		 *
+		 * The system receives no new work, finishes its work on progress and then {@link leave leaves}. Default 
+		 * {@link ExternalSystemArray} does not track work on progress, thus the system leaves at once.
+		 *
+		 * @param system A system to drain.
+		 */
+		virtual void drain(std::shared_ptr<System> system)
+		{
+			leave(system);
+		};
+
+		/**
+		 * Leave a system.
+		 *
+		 * Erases the system and publishes the {@link _Get_snapshot snapshot}. The connection is not closed; 
+		 * {@link ExternalSystem.close close} it if the remote system is not needed anymore.
+		 *
+		 * @param system A system to leave.
+		 * @return Whether the system was a member.
+		 */
+		virtual auto leave(std::shared_ptr<System> system) -> bool
+		{
+			std::unique_lock<std::shared_mutex> uk(getMutex());
+
+			for (size_t i = 0; i < size(); i++)
+				if (at(i) == system)
+				{
+					this->erase(begin() + i);
+					return true;
+				}
+			return false;
+		};
+
 		/* ---------------------------------------------------------
 			MESSAGE CHAIN
 		--------------------------------------------------------- */
 		/**
 		 * Send an {@link Invoke} message.
 		 * 
+		 * Broadcasts the {@link Invoke} message to all the children {@link ExternalSystem} objects. The message is 
+		 * serialized only once into an {@link InvokeFrame} and the frame is shared by all the systems. Sending is 
+		 * done by asynchronous writers of the systems; this method returns when the frame is enqueued to all of them.
+		 * The systems are read from the {@link _Get_snapshot snapshot}, without locking.
+		 * 
 		 * @param invoke An {@link Invoke} message to send.
 		 */
 		virtual void sendData(std::shared_ptr<protocol::Invoke> invoke)
 		{
-			std::vector<std::thread> threads;
-			std::shared_lock<std::shared_mutex> uk(getMutex());
-			
-			threads.reserve(this->size());
-			for (size_t i = 0; i < size(); i++)
-				threads.emplace_back(&ExternalSystem::sendData, at(i).get(), invoke);
-			
-			uk.unlock();
-			for (auto it = threads.begin(); it != threads.end(); it++)
-				it->join();
+			std::shared_ptr<const protocol::InvokeFrame> frame(new protocol::InvokeFrame(invoke));
+			std::shared_ptr<const std::vector<std::shared_ptr<ExternalSystem>>> snapshot = _Get_snapshot();
+
+			for (size_t i = 0; i < snapshot->size(); i++)
+				snapshot->at(i)->sendFrame(frame);
 		};
 
 		/**
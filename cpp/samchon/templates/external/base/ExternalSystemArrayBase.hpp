@@ -3,7 +3,10 @@
 
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <mutex>
 #include <shared_mutex>
+#include <samchon/templates/external/BlobStore.hpp>
 
 namespace samchon
 {
@@ -18,13 +21,67 @@ namespace base
 	class ExternalSystemArrayBase
 	{
 	private:
-		std::shared_mutex mtx;
+		mutable std::shared_mutex mtx;
+		BlobStore blob_store_;
+
+		// READ-MOSTLY COPY OF THE CHILDREN, REPLACED AS A WHOLE
+		mutable std::shared_ptr<const std::vector<std::shared_ptr<ExternalSystem>>> snapshot_;
 
 	public:
 		virtual auto _Get_children() const -> std::vector<std::shared_ptr<ExternalSystem>> = 0;
 
+		/**
+		 * Get mutex of the membership.
+		 *
+		 * Lock it uniquely when inserting or erasing children systems. Mutators of the {@link ExternalSystemArray} and 
+		 * its ```construct()``` publish the {@link _Get_snapshot snapshot} by themselves; call 
+		 * {@link _Publish_snapshot} before unlocking only when the children are modified in other ways. Readers of 
+		 * the membership do not lock it, but read the {@link _Get_snapshot snapshot}.
+		 */
 		auto getMutex() -> std::shared_mutex& { return mtx; };
 		auto getMutex() const -> const std::shared_mutex& { return mtx; };
+
+		/**
+		 * Get snapshot of the children.
+		 *
+		 * The snapshot is an immutable copy of the children systems, replaced as a whole by 
+		 * {@link _Publish_snapshot} whenever the membership changes (RCU-style). Reading it takes neither 
+		 * {@link getMutex} nor any other lock, and systems in a snapshot are kept alive while the snapshot is held, 
+		 * even if they've been erased meanwhile.
+		 *
+		 * Hold the snapshot before locking others; releasing it may destruct an erased system.
+		 */
+		auto _Get_snapshot() const -> std::shared_ptr<const std::vector<std::shared_ptr<ExternalSystem>>>
+		{
+			std::shared_ptr<const std::vector<std::shared_ptr<ExternalSystem>>> snapshot = std::atomic_load(&snapshot_);
+			if (snapshot != nullptr)
+				return snapshot;
+
+			// NOT PUBLISHED YET
+			std::shared_lock<std::shared_mutex> uk(mtx);
+			snapshot.reset(new std::vector<std::shared_ptr<ExternalSystem>>(_Get_children()));
+			std::atomic_store(&snapshot_, snapshot);
+
+			return snapshot;
+		};
+
+		/**
+		 * Publish snapshot of the children.
+		 *
+		 * Call it after the membership has changed without the mutators of the {@link ExternalSystemArray}, with 
+		 * {@link getMutex} locked uniquely.
+		 */
+		void _Publish_snapshot()
+		{
+			std::shared_ptr<const std::vector<std::shared_ptr<ExternalSystem>>> snapshot(new std::vector<std::shared_ptr<ExternalSystem>>(_Get_children()));
+			std::atomic_store(&snapshot_, snapshot);
+		};
+
+		/**
+		 * Get the {@link BlobStore}, blobs to be cached in the external systems.
+		 */
+		auto getBlobStore() -> BlobStore& { return blob_store_; };
+		auto getBlobStore() const -> const BlobStore& { return blob_store_; };
 	};
 };
 };
@@ -11,4 +11,13 @@
 #	include <samchon/templates/parallel/ParallelClientArrayMediator.hpp>
 #	include <samchon/templates/parallel/ParallelServerArrayMediator.hpp>
 #	include <samchon/templates/parallel/ParallelServerClientArrayMediator.hpp>
-#include <samchon/templates/parallel/MediatorSystem.hpp>
\ No newline at end of file
+#include <samchon/templates/parallel/MediatorSystem.hpp>
+
+#include <samchon/templates/parallel/Partitioner.hpp>
+#	include <samchon/templates/parallel/WeightedPartitioner.hpp>
+#	include <samchon/templates/parallel/OverDecomposedPartitioner.hpp>
+#	include <samchon/templates/parallel/ChunkQueue.hpp>
+#	include <samchon/templates/parallel/CostModel.hpp>
+
+#include <samchon/templates/parallel/Reducer.hpp>
+#	include <samchon/templates/parallel/TypedReducer.hpp>
\ No newline at end of file
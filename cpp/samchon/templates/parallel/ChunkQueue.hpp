@@ -0,0 +1,132 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/InvokeFrame.hpp>
+
+#include <deque>
+#include <cmath>
+#include <algorithm>
+
+namespace samchon
+{
+namespace templates
+{
+namespace parallel
+{
+	/**
+	 * A queue of chunks for the dynamic mode.
+	 *
+	 * The {@link ChunkQueue} holds pieces of a *parallel process* which are not allocated to any
+	 * {@link ParallelSystem} yet, in the {@link ParallelSystemArray.setDynamic dynamic mode}. Whenever a
+	 * {@link ParallelSystem} reports completion of its chunk, it pulls the next chunk from the queue.
+	 *
+	 * Sizes of the chunks are *guided*: proportional to the remained pieces, so that chunks shrink as the queue
+	 * drains. A chunk is ```ceil(remained * share / 2)``` where *share* is the pulling system's portion of the total
+	 * performance index, but not less than the minimum size.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class ChunkQueue
+	{
+	private:
+		std::shared_ptr<protocol::Invoke> invoke_;
+		std::shared_ptr<const protocol::InvokeFrame> frame_;
+
+		std::deque<std::pair<size_t, size_t>> ranges_;
+		size_t size_;
+		size_t min_size_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from a parallel process.
+		 *
+		 * @param invoke An {@link Invoke} message requesting the parallel process.
+		 * @param frame Serialized *invoke*, shared part of the chunks' messages.
+		 * @param minSize Minimum size of a chunk.
+		 */
+		ChunkQueue(std::shared_ptr<protocol::Invoke> invoke, std::shared_ptr<const protocol::InvokeFrame> frame, size_t minSize)
+		{
+			invoke_ = invoke;
+			frame_ = frame;
+
+			size_ = 0;
+			min_size_ = std::max<size_t>(minSize, 1);
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		auto getInvoke() const -> std::shared_ptr<protocol::Invoke>
+		{
+			return invoke_;
+		};
+		auto getFrame() const -> std::shared_ptr<const protocol::InvokeFrame>
+		{
+			return frame_;
+		};
+
+		/**
+		 * Get number of remained pieces.
+		 */
+		auto size() const -> size_t
+		{
+			return size_;
+		};
+		auto empty() const -> bool
+		{
+			return size_ == 0;
+		};
+
+		/* ---------------------------------------------------------
+			ELEMENTS I/O
+		--------------------------------------------------------- */
+		/**
+		 * Push a range of pieces.
+		 *
+		 * @param first Initial piece's index.
+		 * @param last Final piece's index, not included.
+		 */
+		void push(size_t first, size_t last)
+		{
+			if (first >= last)
+				return;
+
+			ranges_.emplace_back(first, last);
+			size_ += last - first;
+		};
+
+		/**
+		 * Pop a chunk.
+		 *
+		 * @param share Portion of the pulling system in the total performance index, between 0 and 1.
+		 * @return Range of the chunk, [first, last). An empty range if the queue is empty.
+		 */
+		auto pop(double share) -> std::pair<size_t, size_t>
+		{
+			if (ranges_.empty() == true)
+				return { 0, 0 };
+
+			// GUIDED SIZE
+			share = std::min<double>(std::max<double>(share, 0.0), 1.0);
+			size_t chunk_size = (size_t)std::ceil(size_ * share / 2.0);
+			chunk_size = std::max<size_t>(chunk_size, min_size_);
+
+			// CUT FROM THE FRONT RANGE
+			std::pair<size_t, size_t> &front = ranges_.front();
+			size_t first = front.first;
+			size_t last = std::min<size_t>(front.second, first + chunk_size);
+
+			front.first = last;
+			if (front.first == front.second)
+				ranges_.pop_front();
+
+			size_ -= last - first;
+			return { first, last };
+		};
+	};
+};
+};
+};
@@ -0,0 +1,216 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <cmath>
+#include <algorithm>
+
+namespace samchon
+{
+namespace templates
+{
+namespace parallel
+{
+	/**
+	 * A cost model of a system.
+	 *
+	 * The {@link CostModel} estimates the time a system takes to process pieces, separating fixed overhead (latency)
+	 * from throughput:
+	 *
+	 * ```
+	 * time = overhead + size / rate
+	 * ```
+	 *
+	 * The two terms are fitted by online least squares from observations, pairs of *size* and elapsed *time*. Old
+	 * observations are discounted by the *forgetting factor*, so that the model follows changes of the system. Each
+	 * observation costs constant time and memory.
+	 *
+	 * If sizes of the observations do not vary, the overhead cannot be separated from the rate. Then the overhead is
+	 * regarded as zero and the {@link getConfidence confidence} is halved.
+	 *
+	 * The network {@link getLatency latency}, round trip time measured by pings, is given apart from the observations.
+	 * Observations exclude it and the {@link getOverhead overhead} includes it, thus a slow network is not mistaken
+	 * for a slow system.
+	 *
+	 * @see {@link ParallelSystem.getCostModel}, {@link WeightedPartitioner}
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class CostModel
+	{
+	private:
+		double forgetting_;
+
+		// DISCOUNTED SUMS OF WEIGHTS, SIZES, TIMES AND PRODUCTS
+		double w_;
+		double s_;
+		double t_;
+		double ss_;
+		double st_;
+
+		double overhead_;
+		double rate_;
+		bool separable_;
+
+		double latency_{ 0.0 };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from forgetting factor.
+		 *
+		 * @param forgetting Forgetting factor in (0, 1]. Weight of an observation decays by the factor whenever a new
+		 *					 observation comes. ```1.0``` means no forgetting.
+		 */
+		CostModel(double forgetting = .95)
+		{
+			forgetting_ = std::min<double>(std::max<double>(forgetting, .01), 1.0);
+			clear();
+		};
+
+		/**
+		 * Clear observations.
+		 */
+		void clear()
+		{
+			w_ = s_ = t_ = ss_ = st_ = 0.0;
+
+			overhead_ = 0.0;
+			rate_ = 0.0;
+			separable_ = false;
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get estimated overhead, fixed time per message, including the {@link getLatency latency}.
+		 */
+		auto getOverhead() const -> double
+		{
+			return overhead_ + latency_;
+		};
+
+		/**
+		 * Get latency, round trip time of the network.
+		 */
+		auto getLatency() const -> double
+		{
+			return latency_;
+		};
+
+		/**
+		 * Set latency.
+		 *
+		 * @param val Round trip time of the network, like {@link ClockEstimator.getRoundTrip}.
+		 */
+		void setLatency(double val)
+		{
+			latency_ = std::max<double>(val, 0.0);
+		};
+
+		/**
+		 * Get estimated rate, number of pieces per unit time.
+		 *
+		 * @return The rate, ```0``` if nothing has been observed.
+		 */
+		auto getRate() const -> double
+		{
+			return rate_;
+		};
+
+		/**
+		 * Get confidence of the estimation, between 0 and 1.
+		 *
+		 * The confidence is ```n / (n + 2)``` where *n* is the effective number of observations, the sum of the
+		 * discounted weights. It's halved when the overhead is not separable from the rate.
+		 */
+		auto getConfidence() const -> double
+		{
+			if (rate_ <= 0.0)
+				return 0.0;
+
+			double confidence = w_ / (w_ + 2.0);
+			return separable_ ? confidence : confidence / 2.0;
+		};
+
+		/**
+		 * Estimate elapsed time of processing pieces.
+		 *
+		 * @param size Number of pieces.
+		 * @return Estimated time, ```overhead + size / rate```.
+		 */
+		auto estimate(double size) const -> double
+		{
+			if (rate_ <= 0.0)
+				return getOverhead();
+			else
+				return getOverhead() + size / rate_;
+		};
+
+		/**
+		 * Get a throttled model.
+		 *
+		 * @param availability Ratio of the system's capacity available, like {@link ParallelSystem._Compute_availability}.
+		 * @return A copy of this model, whose rate is multiplied by the *availability*.
+		 */
+		auto throttle(double availability) const -> CostModel
+		{
+			CostModel model = *this;
+			model.rate_ *= availability;
+
+			return model;
+		};
+
+		/* ---------------------------------------------------------
+			OBSERVATION
+		--------------------------------------------------------- */
+		/**
+		 * Observe a processing.
+		 *
+		 * @param size Number of pieces processed.
+		 * @param time Elapsed time of the processing, excluding the {@link getLatency latency}.
+		 */
+		void observe(double size, double time)
+		{
+			if (size <= 0.0 || time <= 0.0)
+				return;
+
+			// DISCOUNT THE OLD ONES
+			w_ = w_ * forgetting_ + 1.0;
+			s_ = s_ * forgetting_ + size;
+			t_ = t_ * forgetting_ + time;
+			ss_ = ss_ * forgetting_ + size * size;
+			st_ = st_ * forgetting_ + size * time;
+
+			fit();
+		};
+
+	private:
+		void fit()
+		{
+			double mean_s = s_ / w_;
+			double mean_t = t_ / w_;
+
+			double var = ss_ / w_ - mean_s * mean_s;
+			double cov = st_ / w_ - mean_s * mean_t;
+
+			// SLOPE IS THE TIME PER A PIECE
+			double slope = (var > 1e-9 * mean_s * mean_s) ? cov / var : -1.0;
+			double intercept = mean_t - slope * mean_s;
+
+			separable_ = (slope > 0.0 && intercept >= 0.0);
+			if (separable_ == false)
+			{
+				// THROUGH THE ORIGIN; NO OVERHEAD
+				slope = st_ / ss_;
+				intercept = 0.0;
+			}
+
+			overhead_ = intercept;
+			rate_ = (slope > 0.0) ? 1.0 / slope : 0.0;
+		};
+	};
+};
+};
+};
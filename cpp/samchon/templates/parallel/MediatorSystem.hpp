@@ -4,12 +4,18 @@
 #include <samchon/templates/slave/SlaveSystem.hpp>
 #include <samchon/protocol/IListener.hpp>
 
+#include <samchon/templates/parallel/ParallelSystem.hpp>
 #include <samchon/templates/parallel/base/ParallelSystemArrayBase.hpp>
 #include <samchon/templates/distributed/base/DistributedSystemArrayBase.hpp>
 #include <samchon/templates/distributed/base/DistributedProcessBase.hpp>
 
 #include <mutex>
-#include <samchon/HashMap.hpp>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <unordered_map>
+#include <unordered_set>
+#include <samchon/templates/parallel/PRInvokeHistory.hpp>
 
 namespace samchon
 {
@@ -40,6 +46,10 @@ namespace parallel
 	 * {@link ParallelSystem} objects. When the *parallel process* has completed, then {@link MediatorSystem} reports the 
 	 * result to its **master**.
 	 * 
+	 * Reports of the completed *processes* are not sent one by one. They're batched for a 
+	 * {@link setReportInterval report interval} and sent in a ```_Report_histories``` message by a single sender, 
+	 * so that a deep tree of mediators does not spawn a thread per completion.
+	 * 
 	 * ![Class Diagram](http://samchon.github.io/framework/images/design/cpp_class_diagram/templates_parallel_system.png)
 	 * 
 	 * @handbook [Templates - Parallel System](https://github.com/samchon/framework/wiki/CPP-Templates-Parallel_System),
@@ -54,10 +64,20 @@ namespace parallel
 		typedef slave::SlaveSystem super;
 
 		external::base::ExternalSystemArrayBase *system_array_;
-		HashMap<size_t, std::shared_ptr<slave::InvokeHistory>> progress_list_;
 
+		// HISTORIES ON PROGRESS, GUARDED BY THE MTX_
+		std::unordered_multimap<size_t, std::shared_ptr<slave::InvokeHistory>> progress_list_;
+		std::unordered_set<size_t> traced_set_;
 		std::mutex mtx_;
 
+		// REPORTS WAITING FOR THE SENDER
+		std::vector<std::shared_ptr<protocol::Invoke>> reports_;
+		std::chrono::milliseconds report_interval_;
+		std::thread reporter_;
+		std::mutex report_mtx_;
+		std::condition_variable report_cv_;
+		bool stopped_;
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -71,12 +91,27 @@ namespace parallel
 			: super()
 		{
 			this->system_array_ = systemArray;
+
+			report_interval_ = std::chrono::milliseconds(10);
+			stopped_ = false;
 		};
 
 		/**
 		 * Default Destructor.
+		 *
+		 * Stops the sender, after sending the remained reports.
 		 */
-		virtual ~MediatorSystem() = default;
+		virtual ~MediatorSystem()
+		{
+			{
+				std::unique_lock<std::mutex> uk(report_mtx_);
+				stopped_ = true;
+			}
+			report_cv_.notify_all();
+
+			if (reporter_.joinable() == true)
+				reporter_.join();
+		};
 
 		/**
 		 * Start interaction.
@@ -99,37 +134,137 @@ namespace parallel
 			return (SystemArray*)system_array_;
 		};
 
+		/**
+		 * Get report interval.
+		 */
+		auto getReportInterval() const -> std::chrono::milliseconds
+		{
+			return report_interval_;
+		};
+
+		/**
+		 * Set report interval.
+		 *
+		 * Reports of completed *processes* are batched for the interval, from the first one, and sent together. 
+		 * Longer interval makes fewer messages but delays the reports.
+		 *
+		 * @param val The interval, default is 10 milliseconds. Zero sends the reports without waiting.
+		 */
+		void setReportInterval(std::chrono::milliseconds val)
+		{
+			std::unique_lock<std::mutex> uk(report_mtx_);
+			report_interval_ = val;
+		};
+
+	protected:
+		/**
+		 * Get current time, of the parent {@link ParallelSystemArrayMediator}.
+		 */
+		virtual auto _Now() const -> std::chrono::system_clock::time_point override
+		{
+			return ((base::ParallelSystemArrayBase*)system_array_)->_Now();
+		};
+
+	public:
 		/* ---------------------------------------------------------
 			INVOKE MESSAGE CHAIN
 		--------------------------------------------------------- */
-		void _Complete_history(size_t uid)
+		void _Complete_history(size_t uid, std::shared_ptr<protocol::InvokeParameter> result = nullptr)
 		{
 			//--------
 			// NEED TO REDEFINE START AND END TIME
 			//--------
+			// COMPLETE THE HISTORIES; ALL THE PIECES HAVING THE UID
+			std::vector<std::shared_ptr<slave::InvokeHistory>> histories;
+			bool traced;
+			{
+				std::unique_lock<std::mutex> uk(mtx_);
+				traced = (traced_set_.erase(uid) != 0);
+
+				auto range = progress_list_.equal_range(uid);
+				for (auto it = range.first; it != range.second; it++)
+					histories.push_back(it->second);
+
+				// ERASE THE HISTORIES ON PROGRESS LIST
+				progress_list_.erase(uid);
+			}
+
 			// NO SUCH HISTORY; THE PROCESS HAD DONE ONLY IN THIS MEDIATOR LEVEL.
-			if (progress_list_.has(uid) == false)
+			if (histories.empty() == true)
 				return;
 
-			// COMPLETE THE HISTORY
-			std::shared_ptr<slave::InvokeHistory> history = progress_list_.get(uid);
-			history->complete();
+			for (size_t i = 0; i < histories.size(); i++)
+				histories[i]->complete();
+
+			// SPANS OF THIS MEDIATOR AND ITS SLAVES, IN THIS MEDIATOR'S CLOCK
+			std::shared_ptr<tracing::SpanArray> trace;
+			if (traced == true)
+			{
+				trace = ((base::ParallelSystemArrayBase*)system_array_)->getTracer()._Take(uid);
+
+				std::chrono::system_clock::time_point received = histories.front()->getStartTime();
+				for (size_t i = 0; i < histories.size(); i++)
+				{
+					trace->emplace_back(new tracing::Span("mediate", "", uid, histories[i]->getStartTime(), histories[i]->getEndTime()));
+					received = std::min<std::chrono::system_clock::time_point>(received, histories[i]->getStartTime());
+				}
+				trace->setReceived(received);
+				trace->setSent(_Now());
+			}
+
+			// REPORT THE HISTORIES TO MASTER, THE PRE-REDUCED RESULT AND THE SPANS WITH THE FIRST ONE
+			std::unique_lock<std::mutex> uk(report_mtx_);
+			for (size_t i = 0; i < histories.size(); i++)
+			{
+				std::shared_ptr<protocol::Invoke> invoke = histories[i]->toInvoke();
+				if (i == 0 && result != nullptr)
+					invoke->push_back(result);
+				if (i == 0 && trace != nullptr)
+					invoke->emplace_back(new protocol::InvokeParameter("_Trace", trace->toXML()));
 
-			// ERASE THE HISTORY ON PROGRESS LIST
-			progress_list_.erase(uid);
+				reports_.push_back(invoke);
+			}
 
-			// REPORT THE HISTORY TO MASTER
-			std::thread(&MediatorSystem::sendData, this, history->toInvoke()).detach();
+			// START THE SENDER LAZILY
+			if (reporter_.joinable() == false && stopped_ == false)
+				reporter_ = std::thread(&MediatorSystem::report, this);
+			else
+				report_cv_.notify_one();
 		};
 
 	private:
 		virtual void _Reply_data(std::shared_ptr<protocol::Invoke> invoke) override final
 		{
+			if (invoke->getListener() == "_Cancel_history")
+			{
+				_Cancel_history(invoke);
+				return;
+			}
+			else if (invoke->getListener() == "_Ping")
+			{
+				_Reply_ping(invoke);
+				return;
+			}
+			else if (_Handle_blobs(invoke) == true)
+				return;
+
 			if (invoke->has("_History_uid") == true)
 			{
 				// REGISTER THIS PROCESS ON HISTORY LIST
-				std::shared_ptr<slave::InvokeHistory> history(new slave::InvokeHistory(invoke));
-				progress_list_.insert({ history->getUID(), history });
+				std::shared_ptr<slave::InvokeHistory> history;
+				if (invoke->has("_Piece_first") == true)
+					history.reset(new PRInvokeHistory(invoke));
+				else
+					history.reset(new slave::InvokeHistory(invoke));
+
+				{
+					std::unique_lock<std::mutex> uk(mtx_);
+					progress_list_.insert({ history->getUID(), history });
+
+					// TRACED BY THE MASTER; THE _TRACE PARAMETER IS FORWARDED TO THE SLAVES
+					if (invoke->has("_Trace") == true)
+						traced_set_.insert(history->getUID());
+				}
 
 				if (invoke->has("_Piece_first") == true)
 				{
@@ -159,6 +294,122 @@ namespace parallel
 				replyData(invoke);
 		};
 
+		void _Cancel_history(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			size_t uid = invoke->front()->getValue<size_t>();
+			size_t first = (invoke->size() > 1) ? invoke->at(1)->getValue<size_t>() : (size_t)-1;
+
+			bool remained;
+			{
+				std::unique_lock<std::mutex> uk(mtx_);
+
+				// ERASE THE CANCELLED HISTORIES, NOT TO BE REPORTED
+				auto range = progress_list_.equal_range(uid);
+				for (auto it = range.first; it != range.second;)
+				{
+					std::shared_ptr<PRInvokeHistory> history = std::dynamic_pointer_cast<PRInvokeHistory>(it->second);
+					if (first == (size_t)-1 || (history != nullptr && history->getFirst() == first))
+						it = progress_list_.erase(it);
+					else
+						it++;
+				}
+				remained = (progress_list_.count(uid) != 0);
+				if (remained == false)
+					traced_set_.erase(uid);
+			}
+
+			// CANCEL THE SUB-PROCESSES IN THE SLAVES, UNLESS OTHER PIECES OF THE UID ARE ON PROGRESS.
+			// SUB-PIECES OF A PIECE CANNOT BE DISTINGUISHED FROM THE OTHER PIECES' ONES.
+			if (remained == false)
+				((base::ParallelSystemArrayBase*)system_array_)->cancel(uid);
+		};
+
+		void report()
+		{
+			std::unique_lock<std::mutex> uk(report_mtx_);
+
+			while (true)
+			{
+				if (reports_.empty() == true)
+				{
+					if (stopped_ == true)
+						break;
+
+					report_cv_.wait(uk);
+					continue;
+				}
+
+				// GATHER REPORTS FOR THE INTERVAL, FROM THE FIRST ONE
+				if (stopped_ == false && report_interval_.count() > 0)
+					report_cv_.wait_for(uk, report_interval_, [this]() -> bool
+					{
+						return stopped_;
+					});
+
+				std::vector<std::shared_ptr<protocol::Invoke>> reports = move(reports_);
+				reports_.clear();
+
+				// A REPORT ALONE, OR HISTORIES FOLLOWED BY THEIR RESULTS
+				std::shared_ptr<protocol::Invoke> invoke;
+				if (reports.size() == 1)
+					invoke = reports.front();
+				else
+				{
+					invoke.reset(new protocol::Invoke("_Report_histories"));
+					for (size_t i = 0; i < reports.size(); i++)
+					{
+						invoke->emplace_back(new protocol::InvokeParameter("_History", reports[i]->front()->getValueAsXML()));
+						for (size_t j = 1; j < reports[i]->size(); j++)
+							invoke->push_back(reports[i]->at(j));
+					}
+				}
+
+				uk.unlock();
+				try
+				{
+					sendData(invoke);
+				}
+				catch (...) {} // DISCONNECTED
+				uk.lock();
+			}
+		};
+
+	protected:
+		virtual auto _Get_backlog() -> slave::Backlog override
+		{
+			// SUM OF THE SLAVES' BACKLOGS, RATIOS WEIGHTED BY THE WORKERS
+			size_t workers = 0;
+			size_t pending = 0;
+			size_t running = 0;
+			double utilization = 0.0;
+			double cpu = 0.0;
+			double process_cpu = 0.0;
+
+			std::shared_ptr<const std::vector<std::shared_ptr<external::ExternalSystem>>> children = system_array_->_Get_snapshot();
+			for (size_t i = 0; i < children->size(); i++)
+			{
+				std::shared_ptr<ParallelSystem> system = std::dynamic_pointer_cast<ParallelSystem>(children->at(i));
+				if (system == nullptr)
+					continue;
+
+				slave::Backlog backlog = system->getBacklog();
+				workers += backlog.getWorkers();
+				pending += backlog.getPending();
+				running += backlog.getRunning();
+				utilization += backlog.getUtilization() * backlog.getWorkers();
+				cpu += backlog.getCpu() * backlog.getWorkers();
+				process_cpu += backlog.getProcessCpu() * backlog.getWorkers();
+			}
+			if (workers != 0)
+			{
+				utilization /= (double)workers;
+				cpu /= (double)workers;
+				process_cpu /= (double)workers;
+			}
+
+			return slave::Backlog(workers, pending, running, utilization, cpu, process_cpu);
+		};
+
 	public:
 		virtual void replyData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
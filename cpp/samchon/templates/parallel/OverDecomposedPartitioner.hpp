@@ -0,0 +1,78 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/parallel/WeightedPartitioner.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace parallel
+{
+	/**
+	 * A partitioner dividing into *k* ranges for each system.
+	 *
+	 * The {@link OverDecomposedPartitioner} divides range of each system, computed same with 
+	 * {@link WeightedPartitioner}, into *k* contiguous *ranges of sub-pieces* with nearly equal sizes. Smaller units 
+	 * of allocation absorb errors of the {@link ParallelSystem.getPerformance performance indices}; a piece left from
+	 * a slow or disconnected system is re-distributed in a smaller size.
+	 *
+	 * The ranges are ordered by rounds; first ranges of all the systems, then second ranges of them, and so on.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class OverDecomposedPartitioner
+		: public WeightedPartitioner
+	{
+	private:
+		size_t k_;
+
+	public:
+		/**
+		 * Construct from number of ranges for each system.
+		 *
+		 * @param k Number of ranges for each system.
+		 * @param minConfidence Minimum {@link CostModel.getConfidence confidence} of the cost models to be used.
+		 */
+		OverDecomposedPartitioner(size_t k, double minConfidence = .5)
+			: WeightedPartitioner(minConfidence)
+		{
+			k_ = std::max<size_t>(k, 1);
+		};
+		virtual ~OverDecomposedPartitioner() = default;
+
+		/**
+		 * Get number of ranges for each system.
+		 */
+		auto getK() const -> size_t
+		{
+			return k_;
+		};
+
+		virtual auto partition(const std::vector<double> &performances, const std::vector<CostModel> &models, size_t first, size_t last) const
+			-> std::vector<IndexPair<std::pair<size_t, size_t>>> override
+		{
+			std::vector<IndexPair<std::pair<size_t, size_t>>> pieces;
+			if (performances.empty() == true || first >= last)
+				return pieces;
+
+			std::vector<size_t> boundaries = compute_boundaries(compute_weights(performances, models, last - first), first, last);
+			pieces.reserve(performances.size() * k_);
+
+			for (size_t j = 0; j < k_; j++)
+				for (size_t i = 0; i < performances.size(); i++)
+				{
+					// J-TH SUB-RANGE OF THE I-TH SYSTEM
+					size_t size = boundaries[i + 1] - boundaries[i];
+					size_t my_first = boundaries[i] + size * j / k_;
+					size_t my_last = boundaries[i] + size * (j + 1) / k_;
+
+					if (my_first < my_last)
+						pieces.emplace_back(i, std::make_pair(my_first, my_last));
+				}
+			return pieces;
+		};
+	};
+};
+};
+};
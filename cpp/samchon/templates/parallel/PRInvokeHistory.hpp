@@ -3,6 +3,8 @@
 
 #include <samchon/templates/slave/InvokeHistory.hpp>
 
+#include <algorithm>
+
 namespace samchon
 {
 namespace templates
@@ -37,6 +39,9 @@ namespace parallel
 
 		size_t first_;
 		size_t last_;
+		size_t size_;
+
+		bool speculative_{ false };
 
 	public:
 		/* ---------------------------------------------------------
@@ -48,6 +53,7 @@ namespace parallel
 		PRInvokeHistory()
 			: super()
 		{
+			first_ = last_ = size_ = 0;
 		};
 
 		/**
@@ -60,6 +66,7 @@ namespace parallel
 		{
 			this->first_ = invoke->get("_Piece_first")->getValue<size_t>();
 			this->last_ = invoke->get("_Piece_last")->getValue<size_t>();
+			this->size_ = last_ - first_;
 		};
 
 		virtual ~PRInvokeHistory() = default;
@@ -70,6 +77,7 @@ namespace parallel
 
 			first_ = xml->getProperty<size_t>("first");
 			last_ = xml->getProperty<size_t>("last");
+			size_ = last_ - first_;
 		};
 
 		/* ---------------------------------------------------------
@@ -103,10 +111,50 @@ namespace parallel
 
 		/**
 		 * Compute number of allocated pieces.
+		 *
+		 * If histories of multiple pieces allocated to a system are merged, it's sum of their sizes.
 		 */
 		auto computeSize() const -> size_t
 		{
-			return last_ - first_;
+			return size_;
+		};
+
+		/**
+		 * @hidden
+		 */
+		auto _Is_speculative() const -> bool
+		{
+			return speculative_;
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Set_speculative(bool val)
+		{
+			speculative_ = val;
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Merge(const PRInvokeHistory &obj)
+		{
+			first_ = std::min<size_t>(first_, obj.first_);
+			last_ = std::max<size_t>(last_, obj.last_);
+			size_ += obj.size_;
+
+			long long x = computeElapsedTime();
+			long long y = obj.computeElapsedTime();
+
+			if (obj.getStartTime() < getStartTime())
+				setStartTime(obj.getStartTime());
+			if (obj.getEndTime() > getEndTime())
+				setEndTime(obj.getEndTime());
+
+			// THE PIECES MAY OVERLAP OR NOT; THE WALL CLOCK SPAN, BOUNDED BY THE STEADY ELAPSED TIMES
+			long long span = std::chrono::duration_cast<std::chrono::nanoseconds>(getEndTime() - getStartTime()).count();
+			_Set_elapsed_time(std::chrono::nanoseconds(std::min<long long>(std::max<long long>(span, std::max<long long>(x, y)), x + y)));
 		};
 
 		/* ---------------------------------------------------------
@@ -7,8 +7,15 @@
 #include <samchon/templates/parallel/base/ParallelSystemArrayBase.hpp>
 
 #include <thread>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <samchon/HashMap.hpp>
 #include <samchon/templates/parallel/PRInvokeHistory.hpp>
+#include <samchon/templates/slave/HistoryWindow.hpp>
+#include <samchon/templates/parallel/CostModel.hpp>
+#include <samchon/templates/slave/Backlog.hpp>
 
 namespace samchon
 {
@@ -62,12 +69,24 @@ namespace parallel
 	private:
 		typedef external::ExternalSystem super;
 
-		HashMap<size_t, std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>> progress_list_;
-		HashMap<size_t, std::shared_ptr<slave::InvokeHistory>> history_list_;
+		// PIECES ON PROGRESS AND THE COST MODEL, GUARDED BY THE PROGRESS_MTX_
+		std::unordered_multimap<size_t, std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>> progress_list_;
+		CostModel cost_model_;
+		mutable std::mutex progress_mtx_;
 
-		double performance_{ 1.0 };
-		bool enforced_{ false };
-		bool excluded_{ false };
+		// ARCHIVED HISTORIES, GUARDED BY THE STATE MUTEX OF THE SYSTEM ARRAY
+		slave::HistoryWindow<slave::InvokeHistory> history_list_;
+
+		std::atomic<double> performance_{ 1.0 };
+		std::atomic<bool> enforced_{ false };
+		std::atomic<bool> excluded_{ false };
+		std::atomic<bool> draining_{ false };
+
+		// BACKLOG OF THE SLAVE, WITH TIME RECEIVED AND NUMBER OF OWN PIECES ON PROGRESS AT THE TIME
+		slave::Backlog backlog_;
+		std::chrono::system_clock::time_point backlog_at_;
+		size_t backlog_outstanding_{ 0 };
+		mutable std::mutex backlog_mtx_;
 
 	public:
 		/* ---------------------------------------------------------
@@ -91,17 +110,12 @@ namespace parallel
 		virtual ~ParallelSystem()
 		{
 			excluded_ = true;
+			if (system_array_ == nullptr)
+				return;
 
 			// SHIFT PARALLEL INVOKE MESSAGES HAD PROGRESSED TO OTHER SLAVES
-			for (auto it = progress_list_.begin(); it != progress_list_.end(); it++)
-			{
-				// INVOKE MESSAGE AND ITS HISTORY ON PROGRESS
-				std::shared_ptr<protocol::Invoke> invoke = it->second.first;
-				std::shared_ptr<slave::InvokeHistory> history = it->second.second;
-
-				// SEND THEM BACK
-				_Send_back_history(invoke, history);
-			}
+			std::unique_lock<std::recursive_mutex> sk(((base::ParallelSystemArrayBase*)system_array_)->_Get_state_mutex());
+			_Send_back_progress();
 		};
 
 		virtual void construct(std::shared_ptr<library::XML> xml) override
@@ -146,6 +160,99 @@ namespace parallel
 			return performance_;
 		};
 
+		/**
+		 * Get cost model.
+		 *
+		 * Get the {@link CostModel} estimating overhead and rate of this system separately, fitted from elapsed times 
+		 * of pieces, measured in the master from sending to reporting. The round trip time of the network, estimated 
+		 * by the {@link getClockEstimator clock estimator}, is excluded from the elapsed times and given as the 
+		 * {@link CostModel.getLatency latency}. If the cost models of the systems are confident, the 
+		 * {@link WeightedPartitioner} solves sizes of pieces with them and the {@link getPerformance performance index} 
+		 * follows the rate.
+		 *
+		 * @return A copy of the {@link CostModel}, which is fitted concurrently.
+		 */
+		auto getCostModel() const -> CostModel
+		{
+			CostModel model;
+			{
+				std::unique_lock<std::mutex> pk(progress_mtx_);
+				model = cost_model_;
+			}
+			model.setLatency(_Compute_latency());
+
+			return model;
+		};
+
+		/**
+		 * Get backlog.
+		 *
+		 * Get the latest {@link Backlog} of the remote system; number of workers, number of processes waiting and 
+		 * running in the remote system and utilization of its workers. The {@link Backlog} is piggybacked on reports 
+		 * of the remote system.
+		 */
+		auto getBacklog() -> slave::Backlog
+		{
+			std::unique_lock<std::mutex> uk(backlog_mtx_);
+			return backlog_;
+		};
+
+		/**
+		 * Compute availability.
+		 *
+		 * Computes ratio of the remote system's capacity available to a new piece, from the latest 
+		 * {@link getBacklog backlog}. The {@link ParallelSystemArray} scales {@link getPerformance performance index} 
+		 * and {@link getCostModel cost model} by the availability when dividing pieces and the {@link SystemSelector} 
+		 * does when selecting a system for a **distributed process**.
+		 *
+		 * - Workers of the slave are discounted by CPU consumed by other processes in the host.
+		 * - Tasks exceeding the workers are waiting in the queue. Tasks of the slave not requested by this master, like
+		 *	 ones of other masters, are counted from the backlog. Pieces requested by this master are counted from 
+		 *	 the progress list, which is more recent than the backlog.
+		 *
+		 * ```
+		 * availability = (1 - foreignCpu) * workers / (workers + max(0, tasks - workers))
+		 * ```
+		 *
+		 * If no backlog has been reported within ten seconds, the availability is ```1.0```. The availability is 
+		 * never less than ```0.05```, so that a busy system keeps receiving a little and reporting its backlog.
+		 *
+		 * @param outstanding Whether to count pieces on progress requested by this master. Load counters of a 
+		 *					  {@link DistributedSystem} already count them.
+		 * @return The availability, in (0, 1].
+		 */
+		auto _Compute_availability(bool outstanding = true) const -> double
+		{
+			size_t progress = outstanding ? _Count_progress() : 0;
+			std::unique_lock<std::mutex> uk(backlog_mtx_);
+
+			if (backlog_.getWorkers() == 0 || ((base::ParallelSystemArrayBase*)system_array_)->_Now() - backlog_at_ > std::chrono::seconds(10))
+				return 1.0;
+
+			// TASKS OF THE SLAVE, NOT REQUESTED BY THIS MASTER
+			double workers = (double)backlog_.getWorkers();
+			double tasks = (double)(backlog_.getPending() + backlog_.getRunning());
+			tasks = std::max<double>(tasks - backlog_outstanding_, 0.0);
+
+			tasks += progress;
+
+			double queued = std::max<double>(tasks - workers, 0.0);
+			double cpu = 1.0 - backlog_.computeForeignCpu();
+
+			return std::max<double>(cpu * workers / (workers + queued), .05);
+		};
+
+		/**
+		 * Compute latency, round trip time of the network.
+		 *
+		 * @return The round trip time estimated by the {@link getClockEstimator clock estimator}, in the unit of 
+		 *		   the {@link CostModel}; ticks of the system clock.
+		 */
+		auto _Compute_latency() const -> double
+		{
+			return (double)std::chrono::duration_cast<std::chrono::system_clock::duration>(getClockEstimator().getRoundTrip()).count();
+		};
+
 		/**
 		 * Set performance index.
 		 *
@@ -209,56 +316,232 @@ namespace parallel
 		/* ---------------------------------------------------------
 			INVOKE MESSAGE CHAIN - PERFORMANCE ESTIMATION
 		--------------------------------------------------------- */
+	public:
+		/**
+		 * Ping the remote system, by the clock of the system array.
+		 */
+		virtual void ping() override
+		{
+			if (system_array_ == nullptr)
+			{
+				super::ping();
+				return;
+			}
+
+			base::ParallelSystemArrayBase *system_array = (base::ParallelSystemArrayBase*)system_array_;
+			_Ping(system_array->_Now(), system_array->_Steady_now());
+		};
+
 	protected:
 		virtual void _Reply_data(std::shared_ptr<protocol::Invoke> invoke) override
 		{
-			if (invoke->getListener() == "_Report_history")
-				_Report_history(invoke->front()->getValueAsXML());
+			if (invoke->getListener() == "_Report_history" || invoke->getListener() == "_Report_histories")
+			{
+				// BACKLOG OF THE SLAVE, PIGGYBACKED
+				receive_backlog(invoke);
+
+				// A REPORT ALONE, OR BATCHED REPORTS OF A MEDIATOR.
+				// EACH HISTORY IS FOLLOWED BY ITS PARTIAL RESULT AND SPANS, IF EXIST
+				bool batched = (invoke->getListener() == "_Report_histories");
+				base::ParallelSystemArrayBase *system_array = (base::ParallelSystemArrayBase*)system_array_;
+
+				for (size_t i = 0; i < invoke->size(); i++)
+				{
+					if (batched ? (invoke->at(i)->getName() != "_History") : (i != 0))
+						continue;
+
+					std::shared_ptr<protocol::InvokeParameter> result;
+					std::shared_ptr<protocol::InvokeParameter> trace;
+
+					for (size_t j = i + 1; j < invoke->size() && invoke->at(j)->getName() != "_History"; j++)
+						if (invoke->at(j)->getName() == "_Trace")
+							trace = invoke->at(j);
+						else if (invoke->at(j)->getName() == "_Error")
+							result = invoke->at(j); // FAILED, INSTEAD OF A PARTIAL RESULT
+						else if (invoke->at(j)->getName() != "_Backlog" && result == nullptr)
+							result = invoke->at(j); // PARTIAL RESULT, TO BE REDUCED
+
+					std::shared_ptr<library::XML> xml = invoke->at(i)->getValueAsXML();
+					if (trace != nullptr)
+						_Trace_history(xml, trace);
+
+					_Report_history(xml, result);
+				}
+
+				// SAMPLE THE CLOCK PERIODICALLY, WHILE THE SLAVE IS WORKING
+				if (getClockEstimator()._Is_due(system_array->_Steady_now()) == true)
+					ping();
+
+				_Check_drained();
+			}
+			else if (invoke->getListener() == "_Pong")
+			{
+				base::ParallelSystemArrayBase *system_array = (base::ParallelSystemArrayBase*)system_array_;
+				_Receive_pong(invoke, system_array->_Now(), system_array->_Steady_now());
+
+				// THE TRACER SHARES THE OFFSET
+				const external::ClockEstimator &estimator = getClockEstimator();
+				system_array->getTracer()._Observe_offset(name, estimator.getRoundTrip().count(), estimator.getOffset().count());
+			}
 			else if (invoke->getListener() == "_Send_back_history")
 			{
 				size_t uid = invoke->front()->getValue<size_t>();
-				auto it = progress_list_.find(uid);
+				std::unique_lock<std::recursive_mutex> sk(((base::ParallelSystemArrayBase*)system_array_)->_Get_state_mutex());
+
+				// ALL THE PIECES HAVING THE UID
+				std::vector<std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>> pieces;
+				{
+					std::unique_lock<std::mutex> pk(progress_mtx_);
+
+					auto range = progress_list_.equal_range(uid);
+					for (auto it = range.first; it != range.second; it++)
+						pieces.push_back(it->second);
+				}
 
-				if (it != progress_list_.end())
-					_Send_back_history(it->second.first, it->second.second);
+				for (size_t i = 0; i < pieces.size(); i++)
+					_Send_back_history(pieces[i].first, pieces[i].second);
 			}
+			else if (invoke->getListener() == "_Fetch_blob")
+				_Send_blob(invoke->front()->getValue<std::string>(), true);
 			else
 				replyData(invoke);
 		};
 
-		virtual void _Report_history(std::shared_ptr<library::XML> xml)
+		virtual void _Report_history(std::shared_ptr<library::XML> xml, std::shared_ptr<protocol::InvokeParameter> result)
 		{
+			base::ParallelSystemArrayBase *system_array = (base::ParallelSystemArrayBase*)system_array_;
+
 			//--------
 			// CONSTRUCT HISTORY
 			//--------
 			std::shared_ptr<PRInvokeHistory> history(new PRInvokeHistory());
 			history->construct(xml);
 
-			// IF THE HISTORY IS NOT EXIST IN PROGRESS, THEN TERMINATE REPORTING
-			auto progress_it = progress_list_.find(history->getUID());
-			if (progress_it == progress_list_.end())
+			//--------
+			// ERASE FROM ORDINARY PROGRESS, ONLY WITH THE PROGRESS MUTEX OF THIS SYSTEM
+			//--------
+			std::shared_ptr<PRInvokeHistory> progress;
+			{
+				std::unique_lock<std::mutex> pk(progress_mtx_);
+
+				// IF THE HISTORY IS NOT EXIST IN PROGRESS, THEN TERMINATE REPORTING
+				auto progress_it = _Find_progress(history->getUID(), xml->hasProperty("first") ? history->getFirst() : (size_t)-1);
+				if (progress_it == progress_list_.end())
+					return;
+
+				// ARCHIVE FIRST AND LAST INDEX
+				progress = std::dynamic_pointer_cast<PRInvokeHistory>(progress_it->second.second);
+				history->first_ = progress->getFirst();
+				history->last_ = progress->getLast();
+				history->size_ = progress->computeSize();
+
+				progress_list_.erase(progress_it);
+
+				// FIT THE COST MODEL, WITH THE ELAPSED TIME FROM SENDING TO REPORTING, EXCEPT THE NETWORK.
+				// DUPLICATED WORK IS EXCLUDED FROM PERFORMANCE LEARNING
+				if (progress->_Is_speculative() == false)
+					cost_model_.observe((double)progress->computeSize(), (double)(system_array->_Now() - progress->getStartTime()).count() - _Compute_latency());
+			}
+			_Pair_backlog();
+
+			//--------
+			// MIGRATE TO THE HISTORY, WITH THE STATE MUTEX OF THE SYSTEM ARRAY
+			//--------
+			std::unique_lock<std::recursive_mutex> sk(system_array->_Get_state_mutex());
+
+			// THE FIRST RESULT WINS; CANCEL THE TWIN OF A SPECULATIVE EXECUTION, OR DROP THIS ONE IF THE TWIN HAS WON
+			if (system_array->_Settle_speculation(this, progress) == false)
 				return;
 
-			// ARCHIVE FIRST AND LAST INDEX
-			history->first_ = std::dynamic_pointer_cast<PRInvokeHistory>(progress_it->second.second)->getFirst();
-			history->last_ = std::dynamic_pointer_cast<PRInvokeHistory>(progress_it->second.second)->getLast();
+			// MERGE THE PARTIAL RESULT, OR FAIL THE PROCESS
+			if (result != nullptr && result->getName() == "_Error")
+				system_array->_Fail_piece(history->getUID(), std::make_exception_ptr(std::runtime_error(result->getValue<std::string>())));
+			else
+				system_array->_Reduce_piece(history->getUID(), result);
 
-			// ERASE FROM ORDINARY PROGRESS AND MIGRATE TO THE HISTORY
-			std::unique_lock<std::shared_mutex> uk(system_array_->getMutex());
+			// A SYSTEM CAN BE ALLOCATED MULTIPLE PIECES OF A PROCESS. THEN MERGE THEIR HISTORIES
+			if (progress->_Is_speculative() == false)
+			{
+				if (history_list_.has(history->getUID()) == false)
+					history_list_.insert(history->getUID(), history, system_array->_Now());
+				else if (std::dynamic_pointer_cast<PRInvokeHistory>(history_list_.get(history->getUID())) != nullptr)
+					std::dynamic_pointer_cast<PRInvokeHistory>(history_list_.get(history->getUID()))->_Merge(*history);
+			}
 
-			progress_list_.erase(progress_it);
-			history_list_.insert({ history->getUID(), history });
+			// PULL THE NEXT CHUNK IN THE DYNAMIC MODE
+			system_array->_Pull_piece(this, history->getUID());
+
+			// NOT ALL THE PIECES ARE DONE
+			if (system_array->_Retire_piece(history->getUID()) == false)
+				return;
 
 			// NOTIFY TO THE MANAGER, SYSTEM_ARRAY
-			((base::ParallelSystemArrayBase*)system_array_)->_Complete_history(history);
+			system_array->_Complete_history(history);
+		};
+
+		/**
+		 * Collect spans reported with a history.
+		 *
+		 * Called before {@link _Report_history}, while the history is still on progress; time of sending the piece is
+		 * paired with the spans, to correct the slave's clock.
+		 *
+		 * @param xml An {@link XML} object represents the history.
+		 * @param trace The ```_Trace``` parameter, spans recorded by the slave.
+		 */
+		void _Trace_history(std::shared_ptr<library::XML> xml, std::shared_ptr<protocol::InvokeParameter> trace)
+		{
+			base::ParallelSystemArrayBase *system_array = (base::ParallelSystemArrayBase*)system_array_;
+			std::chrono::system_clock::time_point received = system_array->_Now();
+
+			size_t uid = xml->getProperty<size_t>("uid");
+			size_t first = xml->hasProperty("first") ? xml->getProperty<size_t>("first") : (size_t)-1;
+
+			// TIME OF SENDING
+			std::chrono::system_clock::time_point sent;
+			{
+				std::unique_lock<std::mutex> pk(progress_mtx_);
+
+				auto progress_it = _Find_progress(uid, first);
+				if (progress_it == progress_list_.end())
+					return;
+
+				sent = progress_it->second.second->getStartTime();
+			}
+
+			tracing::SpanArray spans;
+			spans.construct(trace->getValueAsXML());
+
+			system_array->getTracer()._Collect(name, uid, sent, received, spans);
 		};
 
+		/**
+		 * Send back a history on progress.
+		 *
+		 * Called with the {@link ParallelSystemArray._Get_state_mutex state mutex} of the system array.
+		 */
 		virtual void _Send_back_history(std::shared_ptr<protocol::Invoke> invoke, std::shared_ptr<slave::InvokeHistory> $history)
 		{
+			// ERASE FROM THE PROGRESS LIST
+			{
+				std::unique_lock<std::mutex> pk(progress_mtx_);
+
+				auto range = progress_list_.equal_range($history->getUID());
+				for (auto it = range.first; it != range.second; it++)
+					if (it->second.second == $history)
+					{
+						progress_list_.erase(it);
+						break;
+					}
+			}
+
 			std::shared_ptr<PRInvokeHistory> history = std::dynamic_pointer_cast<PRInvokeHistory>($history);
 			if (history == nullptr)
 				return;
 
+			// THE PIECE IS ALSO ON PROGRESS IN ANOTHER SYSTEM, BY SPECULATIVE EXECUTION
+			if (((base::ParallelSystemArrayBase*)system_array_)->_Promote_speculation(this, history) == true)
+				return;
+
 			// REMOVE UID AND FIRST, LAST INDEXES
 			for (size_t i = invoke->size(); i < invoke->size(); i--)
 			{
@@ -268,15 +551,155 @@ namespace parallel
 					invoke->erase(invoke->begin() + i);
 			}
 
-			// RE-SEND (DISTRIBUTE) THE PIECE TO OTHER SLAVES
-			std::thread
-			(
-				&base::ParallelSystemArrayBase::sendPieceData, (base::ParallelSystemArrayBase*)system_array_,
-				invoke, history->getFirst(), history->getLast()
-			).detach();
+			// RE-SEND (DISTRIBUTE) THE PIECE TO OTHER SLAVES, BY THE EXECUTOR
+			base::ParallelSystemArrayBase *system_array = (base::ParallelSystemArrayBase*)system_array_;
+			size_t first = history->getFirst();
+			size_t last = history->getLast();
 
-			// ERASE FROM THE PROGRESS LIST
-			progress_list_.erase(history->getUID());
+			system_array->_Post([system_array, invoke, history, first, last]()
+			{
+				// ZERO ONLY IF NO SYSTEM IS AVAILABLE; CHUNKS QUEUED FOR PULLS ARE COUNTED IN THE DYNAMIC MODE
+				if (system_array->sendPieceData(invoke, first, last) == 0 && system_array->_Is_cancelled(history->getUID()) == false)
+				{
+					// NO SYSTEM HAS TAKEN OVER THE PIECE; THE PROCESS FAILS, NOT TO COMPLETE WITHOUT THE PIECE
+					std::unique_lock<std::recursive_mutex> sk(system_array->_Get_state_mutex());
+					system_array->_Fail_piece
+					(
+						history->getUID(), 
+						std::make_exception_ptr(std::runtime_error("No system has taken over a piece sent back."))
+					);
+				}
+
+				// RETIRE THE SENT-BACK PIECE AFTER ITS SUBSTITUTES HAVE ENROLLED.
+				// IF THE SUBSTITUTES ARE ALREADY DONE, COMPLETION IS LEFT TO HERE.
+				if (system_array->_Retire_piece(history->getUID()) == true)
+				{
+					std::unique_lock<std::recursive_mutex> sk(system_array->_Get_state_mutex());
+					system_array->_Complete_history(history);
+				}
+			});
+		};
+
+	public:
+		/**
+		 * Cancel histories on progress.
+		 *
+		 * Erases the histories from the progress list, without archiving them or fitting the cost model, and notifies
+		 * the cancellation to the slave system. A report of the cancelled history, if arrives, is ignored.
+		 *
+		 * Called with the {@link ParallelSystemArray._Get_state_mutex state mutex} of the system array.
+		 *
+		 * @param uid Unique ID of the process.
+		 * @param first Initial index of the piece to cancel. Default is all the pieces having the *uid*.
+		 * @return Whether any history has cancelled.
+		 */
+		auto _Cancel_history(size_t uid, size_t first = (size_t)-1) -> bool
+		{
+			std::vector<std::shared_ptr<slave::InvokeHistory>> cancelled;
+			{
+				std::unique_lock<std::mutex> pk(progress_mtx_);
+
+				auto range = progress_list_.equal_range(uid);
+				for (auto it = range.first; it != range.second;)
+				{
+					std::shared_ptr<PRInvokeHistory> history = std::dynamic_pointer_cast<PRInvokeHistory>(it->second.second);
+					if (first == (size_t)-1 || (history != nullptr && history->getFirst() == first))
+					{
+						cancelled.push_back(it->second.second);
+						it = progress_list_.erase(it);
+					}
+					else
+						it++;
+				}
+			}
+			if (cancelled.empty() == true)
+				return false;
+
+			for (size_t i = 0; i < cancelled.size(); i++)
+				_Drop_progress(cancelled[i]);
+			_Check_drained();
+
+			// NOTIFY TO THE SLAVE, BY THE ASYNCHRONOUS WRITER
+			std::shared_ptr<protocol::Invoke> invoke(new protocol::Invoke("_Cancel_history", uid));
+			if (first != (size_t)-1)
+				invoke->emplace_back(new protocol::InvokeParameter("first", first));
+
+			sendFrame(std::make_shared<protocol::InvokeFrame>(invoke));
+			return true;
+		};
+
+	protected:
+		/**
+		 * Handle a history dropped by cancellation.
+		 *
+		 * Called for each history erased from the progress list by {@link _Cancel_history}, with the 
+		 * {@link ParallelSystemArray._Get_state_mutex state mutex} of the system array. Default does nothing.
+		 *
+		 * @param history A cancelled history.
+		 */
+		virtual void _Drop_progress(std::shared_ptr<slave::InvokeHistory>)
+		{
+		};
+
+		/**
+		 * Leave the system array, if drained.
+		 *
+		 * When a {@link _Is_draining draining} system has no piece on progress, it leaves the system array by the 
+		 * executor; not in its own message chain.
+		 */
+		void _Check_drained()
+		{
+			if (draining_ == false || system_array_ == nullptr || _Count_progress() != 0)
+				return;
+
+			base::ParallelSystemArrayBase *system_array = (base::ParallelSystemArrayBase*)system_array_;
+			system_array->_Post([system_array, this]()
+			{
+				system_array->_Leave_drained(this);
+			});
+		};
+
+		/**
+		 * Pair the latest backlog with number of pieces on progress.
+		 *
+		 * Called when a report is handled, just after its piece is erased from the progress list. The pieces still
+		 * on progress are regarded as counted in the backlog, reported with the report.
+		 */
+		void _Pair_backlog()
+		{
+			size_t progress = _Count_progress();
+
+			std::unique_lock<std::mutex> uk(backlog_mtx_);
+			backlog_outstanding_ = progress;
+		};
+
+		/**
+		 * @hidden
+		 */
+		auto _Find_progress(size_t uid, size_t first) -> decltype(progress_list_.begin())
+		{
+			auto range = progress_list_.equal_range(uid);
+			if (first == (size_t)-1)
+				return (range.first == range.second) ? progress_list_.end() : range.first;
+
+			for (auto it = range.first; it != range.second; it++)
+			{
+				std::shared_ptr<PRInvokeHistory> history = std::dynamic_pointer_cast<PRInvokeHistory>(it->second.second);
+				if (history != nullptr && history->getFirst() == first)
+					return it;
+			}
+			return progress_list_.end();
+		};
+
+	private:
+		void receive_backlog(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			if (invoke->has("_Backlog") == false)
+				return;
+
+			std::unique_lock<std::mutex> uk(backlog_mtx_);
+			backlog_.construct(invoke->get("_Backlog")->getValueAsXML());
+			backlog_at_ = ((base::ParallelSystemArrayBase*)system_array_)->_Now();
 		};
 
 	public:
@@ -286,8 +709,8 @@ namespace parallel
 		virtual auto toXML() const -> std::shared_ptr<library::XML> override
 		{
 			std::shared_ptr<library::XML> xml = super::toXML();
-			xml->setProperty("performance", performance_);
-			xml->setProperty("enforced", enforced_);
+			xml->setProperty("performance", performance_.load());
+			xml->setProperty("enforced", enforced_.load());
 
 			return xml;
 		};
@@ -295,11 +718,34 @@ namespace parallel
 		/* ---------------------------------------------------------
 			INTERNAL ACCESSORS
 		--------------------------------------------------------- */
-		auto _Get_progress_list() -> HashMap<size_t, std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>>& { return progress_list_; };
-		auto _Get_progress_list() const -> const HashMap<size_t, std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>>& { return progress_list_; };
+		/**
+		 * Get the progress list, to be accessed with the {@link _Get_progress_mutex progress mutex} locked.
+		 */
+		auto _Get_progress_list() -> std::unordered_multimap<size_t, std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>>& { return progress_list_; };
+		auto _Get_progress_list() const -> const std::unordered_multimap<size_t, std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>>& { return progress_list_; };
 		
-		auto _Get_history_list() -> HashMap<size_t, std::shared_ptr<slave::InvokeHistory>>& { return history_list_; };
-		auto _Get_history_list() const -> const HashMap<size_t, std::shared_ptr<slave::InvokeHistory>>& { return history_list_; };
+		/**
+		 * Get mutex of the progress list and the cost model.
+		 */
+		auto _Get_progress_mutex() const -> std::mutex& { return progress_mtx_; };
+
+		/**
+		 * Count pieces on progress.
+		 *
+		 * @param uid Unique ID of the process. Default is all the processes.
+		 */
+		auto _Count_progress(size_t uid = (size_t)-1) const -> size_t
+		{
+			std::unique_lock<std::mutex> pk(progress_mtx_);
+			return (uid == (size_t)-1) ? progress_list_.size() : progress_list_.count(uid);
+		};
+
+		/**
+		 * Get the archived histories, to be accessed with the {@link ParallelSystemArray._Get_state_mutex state mutex}
+		 * of the system array locked.
+		 */
+		auto _Get_history_list() -> slave::HistoryWindow<slave::InvokeHistory>& { return history_list_; };
+		auto _Get_history_list() const -> const slave::HistoryWindow<slave::InvokeHistory>& { return history_list_; };
 
 		auto _Is_enforced() const -> bool
 		{
@@ -313,6 +759,59 @@ namespace parallel
 		{
 			excluded_ = true;
 		};
+
+		/**
+		 * Include the system again, when it joins after having left or drained.
+		 */
+		void _Set_included()
+		{
+			draining_ = false;
+			excluded_ = false;
+		};
+
+		/**
+		 * Test whether the system is draining; finishing its pieces on progress, to leave.
+		 */
+		auto _Is_draining() const -> bool
+		{
+			return draining_;
+		};
+
+		/**
+		 * Start draining.
+		 *
+		 * Excludes the system from new pieces, and it leaves when its pieces on progress are done.
+		 */
+		void _Set_draining()
+		{
+			excluded_ = true;
+			draining_ = true;
+
+			_Check_drained();
+		};
+
+		/**
+		 * Send back all the histories on progress, to other systems.
+		 *
+		 * Called with the {@link ParallelSystemArray._Get_state_mutex state mutex} of the system array.
+		 */
+		void _Send_back_progress()
+		{
+			decltype(progress_list_) progress_list; // SENDING BACK ERASES ELEMENTS
+			{
+				std::unique_lock<std::mutex> pk(progress_mtx_);
+				progress_list = progress_list_;
+			}
+			for (auto it = progress_list.begin(); it != progress_list.end(); it++)
+			{
+				// INVOKE MESSAGE AND ITS HISTORY ON PROGRESS
+				std::shared_ptr<protocol::Invoke> invoke = it->second.first;
+				std::shared_ptr<slave::InvokeHistory> history = it->second.second;
+
+				// SEND THEM BACK
+				_Send_back_history(invoke, history);
+			}
+		};
 	};
 };
 };
@@ -5,6 +5,16 @@
 #	include <samchon/templates/parallel/ParallelSystem.hpp>
 #include <samchon/templates/parallel/base/ParallelSystemArrayBase.hpp>
 
+#include <samchon/templates/parallel/WeightedPartitioner.hpp>
+#include <samchon/templates/parallel/OverDecomposedPartitioner.hpp>
+#include <samchon/templates/parallel/ChunkQueue.hpp>
+#include <samchon/templates/parallel/TypedReducer.hpp>
+
+#include <chrono>
+#include <future>
+#include <functional>
+#include <stdexcept>
+
 namespace samchon
 {
 namespace templates
@@ -81,6 +91,47 @@ namespace parallel
 	private:
 		typedef external::ExternalSystemArray<System> super;
 
+		std::shared_ptr<Partitioner> partitioner_;
+
+		bool dynamic_;
+		size_t min_chunk_size_;
+		HashMap<size_t, std::shared_ptr<ChunkQueue>> chunk_queues_;
+
+		struct Speculation
+		{
+			size_t total{ 0 };
+			size_t done{ 0 };
+
+			// ELAPSED TIMES OF THE DONE PIECES, EXCEPT THE DUPLICATED
+			double elapsed_sum{ 0.0 };
+			size_t elapsed_count{ 0 };
+
+			bool scheduled{ false };
+
+			// FIRST INDEX OF PIECE -> (ORIGINAL, DUPLICATE)
+			HashMap<size_t, std::pair<ParallelSystem*, ParallelSystem*>> twins;
+
+			// FIRST INDEX OF PIECE -> THE TWIN WHO HAS WON, TO DROP A LATE REPORT OF THE LOSER
+			HashMap<size_t, ParallelSystem*> winners;
+		};
+		bool speculative_;
+		double speculation_quantile_;
+		double speculation_slowdown_;
+		HashMap<size_t, std::shared_ptr<Speculation>> speculations_;
+
+		struct Reduction
+		{
+			std::shared_ptr<Reducer> reducer;
+			std::shared_ptr<protocol::InvokeParameter> value;
+			std::exception_ptr error;
+
+			// SETTLES THE FUTURE; EMPTY IN A MEDIATOR, WHO REPORTS THE VALUE TO ITS MASTER
+			std::function<void(std::shared_ptr<protocol::InvokeParameter>)> resolve;
+			std::function<void(std::exception_ptr)> reject;
+		};
+		HashMap<std::string, std::shared_ptr<Reducer>> reducer_map_;
+		HashMap<size_t, std::shared_ptr<Reduction>> reductions_;
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -92,8 +143,173 @@ namespace parallel
 			: super(),
 			base::ParallelSystemArrayBase()
 		{
+			partitioner_.reset(new WeightedPartitioner());
+
+			dynamic_ = false;
+			min_chunk_size_ = 1;
+
+			speculative_ = false;
+			speculation_quantile_ = .75;
+			speculation_slowdown_ = 1.5;
+		};
+		/**
+		 * Default Destructor.
+		 *
+		 * Stops the executor redistributing pieces, before the children {@link ParallelSystem} objects are destructed.
+		 */
+		virtual ~ParallelSystemArray()
+		{
+			_Get_executor().stop();
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get partitioner.
+		 *
+		 * @return The {@link Partitioner} dividing pieces in {@link sendPieceData}.
+		 */
+		auto getPartitioner() const -> std::shared_ptr<Partitioner>
+		{
+			return partitioner_;
+		};
+
+		/**
+		 * Set partitioner.
+		 *
+		 * Default is {@link WeightedPartitioner}. To absorb errors of the performance indices, use 
+		 * {@link OverDecomposedPartitioner} which allocates *k* pieces to each system.
+		 *
+		 * @param partitioner A {@link Partitioner} dividing pieces in {@link sendPieceData}.
+		 */
+		void setPartitioner(std::shared_ptr<Partitioner> partitioner)
+		{
+			std::unique_lock<std::recursive_mutex> sk(_Get_state_mutex());
+			partitioner_ = partitioner;
+		};
+
+		/**
+		 * Test whether the dynamic mode is enabled.
+		 */
+		auto isDynamic() const -> bool
+		{
+			return dynamic_;
+		};
+
+		/**
+		 * Enable or disable the dynamic mode.
+		 *
+		 * In the dynamic mode, {@link sendPieceData} does not divide the pieces statically by the 
+		 * {@link getPartitioner partitioner}. The pieces are kept in a {@link ChunkQueue} and each 
+		 * {@link ParallelSystem} gets a chunk at first. Whenever a {@link ParallelSystem} reports completion of its
+		 * chunk, it pulls the next chunk. Sizes of the chunks are *guided*, shrinking as the queue drains. Thus, a 
+		 * slow or overloaded system does not delay the entire process, regardless of accuracy of the 
+		 * {@link ParallelSystem.getPerformance performance indices}.
+		 *
+		 * When all the chunks have completed, {@link _Complete_history} is called once, same with the static mode.
+		 * Chunks of a system leaving or disconnected go back to the queue. Chunks no system is left to pull are
+		 * handed to the idle systems; if there's no one, the process fails.
+		 *
+		 * @param flag Whether to enable the dynamic mode.
+		 * @param minChunkSize Minimum number of pieces in a chunk.
+		 */
+		void setDynamic(bool flag, size_t minChunkSize = 1)
+		{
+			std::unique_lock<std::recursive_mutex> sk(_Get_state_mutex());
+
+			dynamic_ = flag;
+			min_chunk_size_ = minChunkSize;
+		};
+
+		/**
+		 * Test whether the speculative execution is enabled.
+		 */
+		auto isSpeculative() const -> bool
+		{
+			return speculative_;
+		};
+
+		/**
+		 * Enable or disable the speculative execution.
+		 *
+		 * A piece sent to a slave system silently slowing down (thermal throttling, noisy neighbor) holds up the
+		 * entire *parallel process*. With the speculative execution, once the *quantile* of pieces of a 
+		 * *parallel process* are done and a piece is running longer than *slowdown* times of its predicted time, the
+		 * piece is duplicated to an idle {@link ParallelSystem}. Whichever result arrives first wins and the other one 
+		 * is cancelled.
+		 *
+		 * The predicted time is from the {@link ParallelSystem.getCostModel cost model} of the system if it's 
+		 * confident, otherwise average elapsed time of the done pieces. Duplicated work is excluded from the 
+		 * performance estimation.
+		 *
+		 * Disabling does not cancel the duplicated pieces on progress; whichever result arrives first still wins.
+		 *
+		 * @param flag Whether to enable the speculative execution.
+		 * @param quantile Ratio of done pieces to start speculating.
+		 * @param slowdown Ratio of elapsed time to predicted time, to regard a piece as a straggler.
+		 */
+		void setSpeculative(bool flag, double quantile = .75, double slowdown = 1.5)
+		{
+			std::unique_lock<std::recursive_mutex> sk(_Get_state_mutex());
+
+			speculative_ = flag;
+			speculation_quantile_ = quantile;
+			speculation_slowdown_ = std::max<double>(slowdown, 1.0);
+
+			// STRAGGLERS ARE NOT DETECTED ANYMORE, BUT THE TWINS ON PROGRESS ARE KEPT UNTIL THEY SETTLE;
+			// EACH PIECE HAVING TWINS MUST RETIRE ONLY ONCE
+		};
+
+		/**
+		 * Test whether a reducer exists.
+		 *
+		 * @param name Name of the reducer.
+		 */
+		auto hasReducer(const std::string &name) const -> bool
+		{
+			return reducer_map_.has(name);
+		};
+
+		/**
+		 * Get a reducer.
+		 *
+		 * @param name Name of the reducer.
+		 * @return The {@link Reducer}, ```nullptr``` if there's not.
+		 */
+		auto getReducer(const std::string &name) const -> std::shared_ptr<Reducer>
+		{
+			auto it = reducer_map_.find(name);
+			return (it == reducer_map_.end()) ? nullptr : it->second;
+		};
+
+		/**
+		 * Insert a reducer.
+		 *
+		 * Registers a {@link Reducer} to be used by {@link reducePieceData}. The name is delivered to the slaves. If 
+		 * a slave is a {@link MediatorSystem mediator}, the {@link ParallelSystemArrayMediator} should have a 
+		 * {@link Reducer} with the same name, to pre-reduce partial results of its slaves. Otherwise, the mediator 
+		 * reports no partial result.
+		 *
+		 * @param name Name of the reducer.
+		 * @param reducer The {@link Reducer} to register.
+		 */
+		void insertReducer(const std::string &name, std::shared_ptr<Reducer> reducer)
+		{
+			std::unique_lock<std::recursive_mutex> sk(_Get_state_mutex());
+			reducer_map_.set(name, reducer);
+		};
+
+		/**
+		 * Erase a reducer.
+		 *
+		 * @param name Name of the reducer.
+		 */
+		void eraseReducer(const std::string &name)
+		{
+			std::unique_lock<std::recursive_mutex> sk(_Get_state_mutex());
+			reducer_map_.erase(name);
 		};
-		virtual ~ParallelSystemArray() = default;
 
 		/* =========================================================
 			INVOKE MESSAGE CHAIN
@@ -155,106 +371,1001 @@ namespace parallel
 		 * {@link ParallelSystem.getPerformance performance indices} of {@link ParallelSystem} objects basis on their
 		 * execution time.
 		 * 
+		 * The *range of pieces* is divided by the {@link getPartitioner partitioner}. The default 
+		 * {@link WeightedPartitioner} allocates one *range of sub-pieces* to each system, like the table above; 
+		 * boundaries are rounded so that every index in [*first*, *last*) is allocated exactly once.
+		 * In the {@link setDynamic dynamic mode}, the pieces are not divided at once, but pulled chunk by chunk.
+		 * Either way, the performance indices and cost models are throttled by 
+		 * {@link ParallelSystem._Compute_availability availabilities}, from backlogs reported by the slaves; a slave
+		 * with long queue or disturbed by other processes takes fewer pieces.
+		 * 
+		 * The *invoke* is serialized only once. Messages to the {@link ParallelSystem} objects are 
+		 * {@link InvokeFrame frames} sharing the serialized *invoke*, with only their *range of sub-pieces* appended.
+		 * The frames are enqueued to asynchronous writers of the {@link ParallelSystem} objects; this method returns 
+		 * without waiting for the transmissions.
+		 * 
+		 * The ```_History_uid``` parameter is attached to the *invoke*. With the *invoke*, the **parallel process** can 
+		 * be {@link cancel cancelled}.
+		 * 
 		 * @param invoke An {@link Invoke} message requesting parallel process.
 		 * @param first Initial piece's index in a section.
 		 * @param last Final piece's index in a section. The range used is [*first*, *last*), which contains 
 		 *			   all the pieces' indices between *first* and *last*, including the piece pointed by index
 		 *			   *first*, but not the piece pointed by the index *last*.
 		 * 
+		 * @return Number of systems taking the pieces. In the {@link setDynamic dynamic mode}, it includes the systems
+		 *		   to pull chunks queued, thus zero means no system is available, not that all of them are busy.
+		 * 
 		 * @see {@link sendSegmentData}, {@link ParallelSystem.getPerformacen}
 		 */
 		virtual auto sendPieceData(std::shared_ptr<protocol::Invoke> invoke, size_t first, size_t last) -> size_t
 		{
-			std::unique_lock<std::shared_mutex> uk(getMutex());
-
+			// ISSUE UID, WITHOUT ANY LOCK. IF THE INVOKE MESSAGE ALREADY HAS ITS OWN UNIQUE ID, KEEP IT
+			//	- THIS IS A TYPE OF ParallelSystemArrayMediator. THE MESSAGE HAS COME FROM ITS MASTER
+			//	- A ParallelSystem HAS DISCONNECTED. THE SYSTEM SHIFTED ITS CHAIN TO OTHER SLAVES.
 			if (invoke->has("_History_uid") == false)
 				invoke->emplace_back(new protocol::InvokeParameter("_History_uid", _Fetch_history_sequence()));
-			else
+
+			size_t uid = invoke->get("_History_uid")->getValue<size_t>();
+
+			// TRACE BY THE TRACER, OR BY THE UPPER MASTER
+			std::chrono::system_clock::time_point dispatched = _Now();
+			bool traced = invoke->has("_Trace");
+
+			if (traced == false && getTracer().isEnabled() == true)
 			{
-				// INVOKE MESSAGE ALREADY HAS ITS OWN UNIQUE ID
-				//	- THIS IS A TYPE OF ParallelSystemArrayMediator. THE MESSAGE HAS COME FROM ITS MASTER
-				//	- A ParallelSystem HAS DISCONNECTED. THE SYSTEM SHIFTED ITS CHAIN TO OTHER SLAVES.
-				size_t uid = invoke->get("_History_uid")->getValue<size_t>();
+				invoke->emplace_back(new protocol::InvokeParameter("_Trace", true));
+				traced = true;
+			}
+
+			// READ THE MEMBERSHIP BEFORE LOCKING THE STATES
+			std::shared_ptr<const std::vector<std::shared_ptr<external::ExternalSystem>>> snapshot = _Get_snapshot();
+			std::unique_lock<std::recursive_mutex> uk(_Get_state_mutex());
 
-				// FOR CASE 1. UPDATE HISTORY_SEQUENCE TO MAXIMUM
-				if (uid > _Get_history_sequence())
-					_Set_history_sequence(uid);
+			// THE PROCESS HAS BEEN CANCELLED, EVEN WHILE WAITING FOR THE LOCK
+			if (_Is_cancelled(uid) == true)
+				return 0;
+
+			// REDUCTION REQUESTED BY THE MASTER; PRE-REDUCE IN THIS MEDIATOR
+			if (invoke->has("_Reducer") == true && reductions_.has(uid) == false)
+			{
+				std::shared_ptr<Reduction> reduction(new Reduction());
+				reduction->reducer = getReducer(invoke->get("_Reducer")->getValue<std::string>());
+
+				reductions_.emplace(uid, reduction);
 			}
 
-			// TOTAL NUMBER OF PIECES TO DIVIDE
-			size_t segment_size = last - first;
+			// SHARED PART OF MESSAGES TO THE SYSTEMS, ENCODED ONLY ONCE
+			std::shared_ptr<const protocol::InvokeFrame> frame(new protocol::InvokeFrame(invoke));
 
 			// SYSTEMS TO BE GET DIVIDED PROCESSES AND
 			std::vector<std::shared_ptr<ParallelSystem>> system_array;
-			std::vector<std::thread> threads;
+			std::vector<std::pair<std::shared_ptr<ParallelSystem>, std::shared_ptr<const protocol::InvokeFrame>>> orders;
+			size_t takers = 0;
 			
-			system_array.reserve(size());
-			threads.reserve(size());
+			system_array.reserve(snapshot->size());
+			orders.reserve(snapshot->size());
 			
 			// POP EXCLUDEDS
-			for (size_t i = 0; i < size(); i++)
+			for (size_t i = 0; i < snapshot->size(); i++)
 			{
-				std::shared_ptr<ParallelSystem> system = at(i);
+				std::shared_ptr<ParallelSystem> system = std::dynamic_pointer_cast<ParallelSystem>(snapshot->at(i));
 				
-				if (system->_Is_excluded() == false)
+				if (system != nullptr && system->_Is_excluded() == false)
 					system_array.push_back(system);
 			}
 
-			// ORDERS
-			for (size_t i = 0; i < system_array.size(); i++)
+			if (dynamic_ == true)
 			{
-				std::shared_ptr<ParallelSystem> system = system_array[i];
-				
-				// COMPUTE FIRST AND LAST INDEX TO ALLOCATE
-				size_t piece_size = (i == system_array.size() - 1)
-					? segment_size - first
-					: (size_t)(segment_size / system_array.size() * system->getPerformance());
-				if (piece_size == 0)
-					continue;
+				//--------
+				// DYNAMIC MODE
+				//--------
+				// ENQUEUE THE PIECES
+				auto it = chunk_queues_.find(uid);
+				if (it == chunk_queues_.end())
+				{
+					// THE QUEUE ITSELF IS OUTSTANDING UNTIL DRAINED
+					it = chunk_queues_.emplace(uid, std::make_shared<ChunkQueue>(invoke, frame, min_chunk_size_)).first;
+					_Enroll_piece(uid);
+				}
+				it->second->push(first, last);
 
-				std::shared_ptr<protocol::Invoke> my_invoke(new protocol::Invoke(invoke->getListener()));
+				// A CHUNK TO EACH SYSTEM NOT PROCESSING THE UID
+				orders = dispatch_chunks(uid, system_array);
+				takers = orders.size();
+
+				// QUEUED; TO BE PULLED BY THE SYSTEMS PROCESSING THE UID
+				if (chunk_queues_.has(uid) == true)
 				{
-					// DUPLICATE INVOKE AND ATTACH PIECE INFO
-					my_invoke->assign(invoke->begin(), invoke->end());
-					my_invoke->emplace_back(new protocol::InvokeParameter("_Piece_first", first));
-					my_invoke->emplace_back(new protocol::InvokeParameter("_Piece_last", last));
-				};
-
-				// ENROLL TO PROGRESS LIST
-				std::shared_ptr<slave::InvokeHistory> history(new PRInvokeHistory(my_invoke));
-				system->_Get_progress_list().emplace(history->getUID(), std::make_pair(invoke, history));
+					takers = 0;
+					for (size_t i = 0; i < system_array.size(); i++)
+						if (system_array[i]->_Is_excluded() == false && system_array[i]->_Count_progress(uid) != 0)
+							takers++;
+				}
+			}
+			else
+			{
+				//--------
+				// STATIC MODE
+				//--------
+				// DIVIDE THE PIECES
+				std::vector<double> performances;
+				std::vector<CostModel> models;
+
+				performances.reserve(system_array.size());
+				models.reserve(system_array.size());
 
-				// ENROLL THE SEND DATA INTO THREADS
-				threads.emplace_back(&ParallelSystem::sendData, system.get(), my_invoke);
-				first += piece_size; // FOR THE NEXT STEP
+				// THROTTLED BY BACKLOGS OF THE SLAVES
+				for (size_t i = 0; i < system_array.size(); i++)
+				{
+					double availability = system_array[i]->_Compute_availability();
+
+					performances.push_back(system_array[i]->getPerformance() * availability);
+					models.push_back(system_array[i]->getCostModel().throttle(availability));
+				}
+
+				std::vector<IndexPair<std::pair<size_t, size_t>>> pieces = partitioner_->partition(performances, models, first, last);
+
+				// ORDERS
+				for (size_t i = 0; i < pieces.size(); i++)
+				{
+					std::shared_ptr<ParallelSystem> system = system_array[pieces[i].get_index()];
+
+					// ENROLL THE PIECE AND ITS SEND DATA
+					orders.emplace_back(system, enroll_piece(system.get(), invoke, frame, pieces[i].getValue().first, pieces[i].getValue().second));
+				}
+				takers = orders.size();
 			}
 			uk.unlock();
 
-			// JOIN THREADS
-			for (auto it = threads.begin(); it != threads.end(); it++)
-				it->join();
+			// ENQUEUE TO THE ASYNCHRONOUS WRITERS
+			for (size_t i = 0; i < orders.size(); i++)
+				orders[i].first->sendFrame(orders[i].second);
+
+			if (traced == true)
+				getTracer().record("dispatch", uid, dispatched, _Now());
+
+			return takers;
+		};
+
+		/**
+		 * Send an {@link Invoke} message with segment size, to be reduced.
+		 *
+		 * @param invoke An {@link Invoke} message requesting parallel process.
+		 * @param size Number of pieces to segment.
+		 * @param reducer Name of the {@link Reducer} merging partial results.
+		 *
+		 * @return A future of the reduced result.
+		 * @see {@link reducePieceData}
+		 */
+		template <typename T>
+		auto reduceSegmentData(std::shared_ptr<protocol::Invoke> invoke, size_t size, const std::string &reducer) -> std::future<T>
+		{
+			return reducePieceData<T>(invoke, 0, size, reducer);
+		};
+
+		/**
+		 * Send an {@link Invoke} message with range of pieces, to be reduced.
+		 *
+		 * Requests a **parallel process** same with {@link sendPieceData}, but the partial results are merged. Each
+		 * slave sets partial result of its piece by {@link PInvoke.setResult}. The partial results are merged by the 
+		 * {@link Reducer} registered with the name, as they arrive. When all the pieces are done, the future gets the 
+		 * merged result.
+		 *
+		 * {@link MediatorSystem Mediators} pre-reduce partial results of their slaves with their own {@link Reducer}
+		 * having the same name. Thus, this master receives one partial result per mediator instead of one per slave.
+		 *
+		 * The future gets an exception if there's no such {@link Reducer}, no partial result has been reported, the
+		 * {@link Reducer} has thrown or the process has been {@link cancel cancelled}.
+		 *
+		 * @param invoke An {@link Invoke} message requesting parallel process.
+		 * @param first Initial piece's index in a section.
+		 * @param last Final piece's index in a section, not included.
+		 * @param reducer Name of the {@link Reducer} merging partial results.
+		 *
+		 * @tparam T Type of the result, supported by the {@link InvokeParameter}.
+		 * @return A future of the reduced result.
+		 */
+		template <typename T>
+		auto reducePieceData(std::shared_ptr<protocol::Invoke> invoke, size_t first, size_t last, const std::string &reducer) -> std::future<T>
+		{
+			std::shared_ptr<std::promise<T>> promise(new std::promise<T>());
+			std::future<T> future = promise->get_future();
+
+			// THE REDUCTION SETTLING THE PROMISE
+			std::shared_ptr<Reduction> reduction(new Reduction());
+			reduction->resolve = [promise](std::shared_ptr<protocol::InvokeParameter> value)
+			{
+				promise->set_value(value->getValue<T>());
+			};
+			reduction->reject = [promise](std::exception_ptr error)
+			{
+				promise->set_exception(error);
+			};
+
+			size_t uid;
+			{
+				std::unique_lock<std::recursive_mutex> uk(_Get_state_mutex());
+
+				reduction->reducer = getReducer(reducer);
+				if (reduction->reducer == nullptr)
+				{
+					reduction->reject(std::make_exception_ptr(std::invalid_argument("No such reducer.")));
+					return future;
+				}
+
+				// ISSUE UID IN ADVANCE, TO ENROLL THE REDUCTION
+				if (invoke->has("_History_uid") == false)
+					invoke->emplace_back(new protocol::InvokeParameter("_History_uid", _Fetch_history_sequence()));
+				if (invoke->has("_Reducer") == false)
+					invoke->emplace_back(new protocol::InvokeParameter("_Reducer", reducer));
+
+				uid = invoke->get("_History_uid")->getValue<size_t>();
+				reductions_.set(uid, reduction);
+			}
+
+			if (sendPieceData(invoke, first, last) == 0)
+			{
+				// NOTHING HAS SENT
+				std::unique_lock<std::recursive_mutex> uk(_Get_state_mutex());
+
+				auto it = reductions_.find(uid);
+				if (it != reductions_.end() && it->second == reduction)
+				{
+					reductions_.erase(it);
+					reduction->reject(std::make_exception_ptr(std::length_error("No piece has been sent.")));
+				}
+			}
+			return future;
+		};
+
+		/**
+		 * Cancel a process.
+		 *
+		 * Cancels a *parallel process* requested by {@link sendPieceData} or a *distributed process* requested by 
+		 * {@link DistributedProcess.sendData}. Pieces on progress are dropped and the cancellation is propagated to 
+		 * the slave systems, through {@link MediatorSystem mediators}, whose handlers can stop early by polling the
+		 * {@link PInvoke.getCancellationToken cancellation token}.
+		 *
+		 * The cancelled process never completes. Its histories are discarded without being archived, thus the 
+		 * {@link ParallelSystem.getPerformance performance indices} are not skewed by the cancellation. Reports of 
+		 * the cancelled pieces, arriving later, are ignored.
+		 *
+		 * @param uid Unique ID of the process, the ```_History_uid``` parameter.
+		 * @return Whether any piece was on progress.
+		 */
+		virtual auto cancel(size_t uid) -> bool override
+		{
+			std::shared_ptr<const std::vector<std::shared_ptr<external::ExternalSystem>>> snapshot = _Get_snapshot();
+			std::unique_lock<std::recursive_mutex> uk(_Get_state_mutex());
+
+			// NOT TO BE COMPLETED OR RE-SENT
+			_Discard_pieces(uid);
+			chunk_queues_.erase(uid);
+			speculations_.erase(uid);
+
+			auto r_it = reductions_.find(uid);
+			if (r_it != reductions_.end())
+			{
+				std::shared_ptr<Reduction> reduction = r_it->second;
+				reductions_.erase(r_it);
+
+				if (reduction->reject != nullptr)
+					reduction->reject(std::make_exception_ptr(std::runtime_error("The process has been cancelled.")));
+			}
+
+			// DROP THE PIECES ON PROGRESS AND NOTIFY TO THE SLAVES
+			bool cancelled = false;
+			for (size_t i = 0; i < snapshot->size(); i++)
+			{
+				std::shared_ptr<ParallelSystem> system = std::dynamic_pointer_cast<ParallelSystem>(snapshot->at(i));
+				if (system != nullptr && system->_Cancel_history(uid) == true)
+					cancelled = true;
+			}
+
+			return cancelled;
+		};
+
+		/**
+		 * Cancel a process.
+		 *
+		 * @param invoke An {@link Invoke} message had sent, having the ```_History_uid``` parameter.
+		 * @return Whether any piece was on progress.
+		 */
+		auto cancel(std::shared_ptr<protocol::Invoke> invoke) -> bool
+		{
+			if (invoke->has("_History_uid") == false)
+				return false;
+
+			return cancel(invoke->get("_History_uid")->getValue<size_t>());
+		};
+
+		/* ---------------------------------------------------------
+			MEMBERSHIP
+		--------------------------------------------------------- */
+		/**
+		 * Join a system.
+		 *
+		 * The system starts with a conservative prior; {@link ParallelSystem.getPerformance performance index} of 
+		 * the slowest member, until its own histories are measured. Then it steals pieces of the processes on 
+		 * progress, which have been partitioned before joining:
+		 *
+		 * - In the {@link setDynamic dynamic mode}, it pulls a chunk from each queue.
+		 * - Otherwise, the piece expected to complete last in each process is duplicated to it, as the 
+		 *	 {@link setSpeculative speculative execution} does. Whichever result arrives first wins.
+		 *
+		 * Safe under concurrent {@link sendPieceData}. A system having left, like an {@link ExternalServer} 
+		 * reconnected, can join again; it is included to new pieces again.
+		 *
+		 * @param system A system to join.
+		 */
+		virtual void join(std::shared_ptr<System> system) override
+		{
+			ParallelSystem *joiner = system.get();
+
+			// A SYSTEM HAVING LEFT JOINS AGAIN
+			joiner->_Set_included();
+
+			// CONSERVATIVE PRIOR, UNLESS ENFORCED
+			if (joiner->_Is_enforced() == false)
+			{
+				std::vector<std::shared_ptr<ParallelSystem>> systems = parallel_systems();
+
+				double prior = -1.0;
+				for (size_t i = 0; i < systems.size(); i++)
+					if (systems[i].get() != joiner && systems[i]->_Is_excluded() == false)
+						prior = (prior < 0.0) ? systems[i]->getPerformance() : std::min<double>(prior, systems[i]->getPerformance());
+
+				if (prior > 0.0)
+					joiner->setPerformance(prior);
+			}
+			super::join(system);
+
+			// STEAL PIECES ON PROGRESS
+			std::vector<std::shared_ptr<const protocol::InvokeFrame>> orders;
+			{
+				std::unique_lock<std::recursive_mutex> uk(_Get_state_mutex());
+				orders = steal_pieces(joiner);
+			}
+
+			for (size_t i = 0; i < orders.size(); i++)
+				joiner->sendFrame(orders[i]);
+		};
+
+		/**
+		 * Drain a system.
+		 *
+		 * The system receives no new piece; neither by {@link sendPieceData}, pulling chunks nor speculative 
+		 * duplicates. It finishes the pieces on progress, then {@link leave leaves}.
+		 *
+		 * @param system A system to drain.
+		 */
+		virtual void drain(std::shared_ptr<System> system) override
+		{
+			((ParallelSystem*)system.get())->_Set_draining();
+		};
+
+		/**
+		 * Leave a system.
+		 *
+		 * The system receives no new piece, and its pieces on progress are sent back to the other systems at once. 
+		 * Reports of the pieces, if arrive later, are ignored. Safe under concurrent {@link sendPieceData}.
+		 *
+		 * @param system A system to leave.
+		 * @return Whether the system was a member.
+		 */
+		virtual auto leave(std::shared_ptr<System> system) -> bool override
+		{
+			ParallelSystem *leaver = system.get();
+
+			// NO MORE PIECES, EVEN FROM CONCURRENT SENDINGS
+			leaver->_Set_excluded();
+			if (super::leave(system) == false)
+				return false;
+
+			// PIECES ENROLLED UNTIL NOW ARE SENT BACK
+			std::unique_lock<std::recursive_mutex> uk(_Get_state_mutex());
+			leaver->_Send_back_progress();
+
+			return true;
+		};
+
+		/**
+		 * @hidden
+		 */
+		virtual void _Leave_drained(ParallelSystem *system) override
+		{
+			std::shared_ptr<System> member;
+			{
+				std::shared_lock<std::shared_mutex> uk(getMutex());
+
+				for (size_t i = 0; i < this->size(); i++)
+					if ((ParallelSystem*)this->at(i).get() == system)
+					{
+						member = this->at(i);
+						break;
+					}
+			}
+
+			// THE SYSTEM HAS LEFT ALREADY, OR ANOTHER ONE AT THE SAME ADDRESS
+			if (member == nullptr || member->_Is_draining() == false || member->_Count_progress() != 0)
+				return;
+
+			leave(member);
+		};
+
+	private:
+		auto enroll_piece(ParallelSystem *system, std::shared_ptr<protocol::Invoke> invoke, std::shared_ptr<const protocol::InvokeFrame> frame, size_t first, size_t last) -> std::shared_ptr<const protocol::InvokeFrame>
+		{
+			// DERIVE A FRAME FROM THE SHARED ONE, ATTACHING PIECE INFO
+			std::shared_ptr<const protocol::InvokeFrame> my_frame(new protocol::InvokeFrame
+			(
+				frame, 
+				{
+					std::make_shared<protocol::InvokeParameter>("_Piece_first", first),
+					std::make_shared<protocol::InvokeParameter>("_Piece_last", last)
+				}
+			));
+
+			// ENROLL TO PROGRESS LIST AND COUNT AS OUTSTANDING
+			std::shared_ptr<slave::InvokeHistory> history(new PRInvokeHistory(my_frame->getInvoke()));
+			history->setStartTime(_Now());
+			{
+				std::unique_lock<std::mutex> pk(system->_Get_progress_mutex());
+				system->_Get_progress_list().emplace(history->getUID(), std::make_pair(invoke, history));
+			}
+			_Enroll_piece(history->getUID());
+
+			if (speculative_ == true)
+			{
+				auto it = speculations_.find(history->getUID());
+				if (it == speculations_.end())
+					it = speculations_.emplace(history->getUID(), std::make_shared<Speculation>()).first;
+				it->second->total++;
+			}
+
+			return my_frame;
+		};
+
+		/**
+		 * Get the children systems, from the {@link _Get_snapshot snapshot} of the membership.
+		 */
+		auto parallel_systems() const -> std::vector<std::shared_ptr<ParallelSystem>>
+		{
+			std::shared_ptr<const std::vector<std::shared_ptr<external::ExternalSystem>>> snapshot = _Get_snapshot();
+
+			std::vector<std::shared_ptr<ParallelSystem>> systems;
+			systems.reserve(snapshot->size());
+
+			for (size_t i = 0; i < snapshot->size(); i++)
+			{
+				std::shared_ptr<ParallelSystem> system = std::dynamic_pointer_cast<ParallelSystem>(snapshot->at(i));
+				if (system != nullptr)
+					systems.push_back(system);
+			}
+			return systems;
+		};
+
+		/**
+		 * Hand chunks of a {@link ChunkQueue} to the idle systems.
+		 *
+		 * Each system not processing the *uid* gets a chunk. The remained chunks are pulled by the systems processing
+		 * the *uid*, when they report. If no system is processing the *uid*, nobody would pull them; the process 
+		 * {@link _Fail_piece fails} and the queue retires.
+		 *
+		 * Called with the {@link _Get_state_mutex state mutex}.
+		 *
+		 * @param systems Systems not excluded.
+		 * @return Orders to be sent, out of the state mutex.
+		 */
+		auto dispatch_chunks(size_t uid, const std::vector<std::shared_ptr<ParallelSystem>> &systems) 
+			-> std::vector<std::pair<std::shared_ptr<ParallelSystem>, std::shared_ptr<const protocol::InvokeFrame>>>
+		{
+			std::vector<std::pair<std::shared_ptr<ParallelSystem>, std::shared_ptr<const protocol::InvokeFrame>>> orders;
+
+			auto it = chunk_queues_.find(uid);
+			if (it == chunk_queues_.end())
+				return orders;
+
+			std::shared_ptr<ChunkQueue> queue = it->second;
+			for (size_t i = 0; i < systems.size() && queue->empty() == false; i++)
+				if (systems[i]->_Is_excluded() == false && systems[i]->_Count_progress(uid) == 0)
+					orders.emplace_back(systems[i], pop_chunk(systems[i].get(), queue));
+
+			if (queue->empty() == false)
+			{
+				// TO BE PULLED
+				for (size_t i = 0; i < systems.size(); i++)
+					if (systems[i]->_Is_excluded() == false && systems[i]->_Count_progress(uid) != 0)
+						return orders;
+
+				// STRANDED; NO SYSTEM WOULD PULL THE CHUNKS
+				_Fail_piece(uid, std::make_exception_ptr(std::runtime_error("No system is left to pull the remained chunks.")));
+			}
+
+			chunk_queues_.erase(uid);
+			retire_queue(queue);
+
+			return orders;
+		};
+
+		/**
+		 * Retire a {@link ChunkQueue}, drained or stranded.
+		 *
+		 * The queue itself has been outstanding. If it was the last one, the process completes here, with an empty 
+		 * history standing for the queue.
+		 */
+		void retire_queue(std::shared_ptr<ChunkQueue> queue)
+		{
+			std::shared_ptr<const protocol::InvokeFrame> frame(new protocol::InvokeFrame
+			(
+				queue->getFrame(), 
+				{
+					std::make_shared<protocol::InvokeParameter>("_Piece_first", (size_t)0),
+					std::make_shared<protocol::InvokeParameter>("_Piece_last", (size_t)0)
+				}
+			));
+			std::shared_ptr<PRInvokeHistory> history(new PRInvokeHistory(frame->getInvoke()));
+
+			if (_Retire_piece(history->getUID()) == true)
+			{
+				history->setStartTime(_Now());
+				history->setEndTime(_Now());
+
+				_Complete_history(history);
+			}
+		};
+
+		auto pop_chunk(ParallelSystem *system, std::shared_ptr<ChunkQueue> queue) -> std::shared_ptr<const protocol::InvokeFrame>
+		{
+			std::vector<std::shared_ptr<ParallelSystem>> systems = parallel_systems();
+
+			// PORTION OF THE SYSTEM IN TOTAL PERFORMANCE INDEX, THROTTLED BY BACKLOGS OF THE SLAVES
+			double sum = 0.0;
+			size_t denominator = 0;
+
+			for (size_t i = 0; i < systems.size(); i++)
+				if (systems[i]->_Is_excluded() == false)
+				{
+					sum += systems[i]->getPerformance() * systems[i]->_Compute_availability();
+					denominator++;
+				}
+			double share = (sum > 0.0) 
+				? system->getPerformance() * system->_Compute_availability() / sum 
+				: 1.0 / std::max<size_t>(denominator, 1);
+
+			// POP A CHUNK AND ENROLL IT
+			std::pair<size_t, size_t> chunk = queue->pop(share);
+			return enroll_piece(system, queue->getInvoke(), queue->getFrame(), chunk.first, chunk.second);
+		};
+
+		/**
+		 * Duplicate a piece on progress to another system, as its twin.
+		 *
+		 * Whichever result arrives first wins and the other one is cancelled. The duplicate is not counted as 
+		 * outstanding.
+		 *
+		 * @return Frame of the duplicate, to be sent to the *idle* system.
+		 */
+		auto enroll_twin(ParallelSystem *owner, std::shared_ptr<protocol::Invoke> invoke, std::shared_ptr<PRInvokeHistory> progress, ParallelSystem *idle) -> std::shared_ptr<const protocol::InvokeFrame>
+		{
+			size_t uid = progress->getUID();
+
+			auto it = speculations_.find(uid);
+			if (it == speculations_.end())
+				it = speculations_.emplace(uid, std::make_shared<Speculation>()).first;
+
+			// ENROLL THE DUPLICATE, WITHOUT COUNTING AS OUTSTANDING
+			std::shared_ptr<const protocol::InvokeFrame> frame(new protocol::InvokeFrame
+			(
+				std::make_shared<protocol::InvokeFrame>(invoke),
+				{
+					std::make_shared<protocol::InvokeParameter>("_Piece_first", progress->getFirst()),
+					std::make_shared<protocol::InvokeParameter>("_Piece_last", progress->getLast())
+				}
+			));
+			std::shared_ptr<PRInvokeHistory> duplicate(new PRInvokeHistory(frame->getInvoke()));
+			duplicate->setStartTime(_Now());
+			duplicate->_Set_speculative(true);
+
+			{
+				std::unique_lock<std::mutex> pk(idle->_Get_progress_mutex());
+				idle->_Get_progress_list().emplace(uid, std::make_pair(invoke, duplicate));
+			}
+			it->second->twins.emplace(progress->getFirst(), std::make_pair(owner, idle));
+
+			return frame;
+		};
+
+		/**
+		 * Steal pieces for a joining system.
+		 *
+		 * In the dynamic mode, the *thief* pulls a chunk from each {@link ChunkQueue}. Otherwise, the piece expected to
+		 * complete last in each process, the largest per the performance index of its owner, is duplicated to the 
+		 * *thief* as a twin. The owner keeps it, thus nothing is lost even if the *thief* fails.
+		 *
+		 * @return Orders to be sent, out of the state mutex.
+		 */
+		auto steal_pieces(ParallelSystem *thief) -> std::vector<std::shared_ptr<const protocol::InvokeFrame>>
+		{
+			std::vector<std::shared_ptr<const protocol::InvokeFrame>> orders;
+
+			//--------
+			// DYNAMIC MODE; A CHUNK OF EACH QUEUE
+			//--------
+			std::vector<size_t> uids;
+			for (auto it = chunk_queues_.begin(); it != chunk_queues_.end(); it++)
+				uids.push_back(it->first);
+
+			for (size_t i = 0; i < uids.size(); i++)
+			{
+				auto it = chunk_queues_.find(uids[i]);
+				if (thief->_Count_progress(uids[i]) != 0)
+					continue;
+
+				orders.push_back(pop_chunk(thief, it->second));
+				if (it->second->empty() == true)
+				{
+					std::shared_ptr<ChunkQueue> queue = it->second;
+					chunk_queues_.erase(it);
+					retire_queue(queue);
+				}
+			}
+
+			//--------
+			// STATIC MODE; THE LATEST PIECE OF EACH PROCESS
+			//--------
+			struct Candidate
+			{
+				ParallelSystem *owner;
+				std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>> piece;
+				double remained;
+			};
+			HashMap<size_t, Candidate> candidates;
+
+			std::vector<std::shared_ptr<ParallelSystem>> systems = parallel_systems();
+			for (size_t i = 0; i < systems.size(); i++)
+			{
+				ParallelSystem *owner = systems[i].get();
+				if (owner == thief)
+					continue;
+
+				std::vector<std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>> pieces;
+				{
+					std::unique_lock<std::mutex> pk(owner->_Get_progress_mutex());
+					for (auto it = owner->_Get_progress_list().begin(); it != owner->_Get_progress_list().end(); it++)
+						pieces.push_back(it->second);
+				}
+
+				for (size_t j = 0; j < pieces.size(); j++)
+				{
+					std::shared_ptr<PRInvokeHistory> progress = std::dynamic_pointer_cast<PRInvokeHistory>(pieces[j].second);
+					if (progress == nullptr || progress->_Is_speculative() == true || chunk_queues_.has(progress->getUID()) == true)
+						continue;
+
+					auto s_it = speculations_.find(progress->getUID());
+					if (s_it != speculations_.end() && s_it->second->twins.has(progress->getFirst()) == true)
+						continue;
+
+					double remained = progress->computeSize() / std::max<double>(owner->getPerformance(), 1e-9);
+					auto c_it = candidates.find(progress->getUID());
+
+					if (c_it == candidates.end())
+						candidates.emplace(progress->getUID(), Candidate{ owner, pieces[j], remained });
+					else if (remained > c_it->second.remained)
+						c_it->second = Candidate{ owner, pieces[j], remained };
+				}
+			}
+
+			for (auto it = candidates.begin(); it != candidates.end(); it++)
+				if (thief->_Count_progress(it->first) == 0)
+				{
+					std::shared_ptr<PRInvokeHistory> progress = std::dynamic_pointer_cast<PRInvokeHistory>(it->second.piece.second);
+					orders.push_back(enroll_twin(it->second.owner, it->second.piece.first, progress, thief));
+				}
+
+			return orders;
+		};
+
+		void speculate(size_t uid)
+		{
+			auto it = speculations_.find(uid);
+			if (speculative_ == false || it == speculations_.end())
+				return;
+
+			std::shared_ptr<Speculation> speculation = it->second;
+			if (speculation->done < speculation->total * speculation_quantile_)
+				return;
+
+			//--------
+			// FIND STRAGGLERS
+			//--------
+			std::chrono::system_clock::time_point now = _Now();
+			std::chrono::system_clock::time_point next = std::chrono::system_clock::time_point::max();
+
+			std::vector<std::pair<ParallelSystem*, std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>>> stragglers;
+			std::vector<std::shared_ptr<ParallelSystem>> systems = parallel_systems();
+
+			for (size_t i = 0; i < systems.size(); i++)
+			{
+				ParallelSystem *system = systems[i].get();
+				CostModel model = system->getCostModel();
+
+				// COPY THE PIECES ON PROGRESS, NOT TO HOLD THE PROGRESS MUTEX
+				std::vector<std::pair<std::shared_ptr<protocol::Invoke>, std::shared_ptr<slave::InvokeHistory>>> pieces;
+				{
+					std::unique_lock<std::mutex> pk(system->_Get_progress_mutex());
+
+					auto range = system->_Get_progress_list().equal_range(uid);
+					for (auto p = range.first; p != range.second; p++)
+						pieces.push_back(p->second);
+				}
+
+				for (size_t j = 0; j < pieces.size(); j++)
+				{
+					std::shared_ptr<PRInvokeHistory> progress = std::dynamic_pointer_cast<PRInvokeHistory>(pieces[j].second);
+					if (progress == nullptr || progress->_Is_speculative() == true || speculation->twins.has(progress->getFirst()) == true)
+						continue;
+
+					// PREDICTED TIME
+					double predicted;
+					if (model.getConfidence() >= .5)
+						predicted = model.estimate((double)progress->computeSize());
+					else if (speculation->elapsed_count != 0)
+						predicted = speculation->elapsed_sum / speculation->elapsed_count;
+					else
+						continue;
+
+					std::chrono::system_clock::time_point deadline = progress->getStartTime() 
+						+ std::chrono::system_clock::duration((std::chrono::system_clock::rep)(predicted * speculation_slowdown_));
+
+					if (now >= deadline)
+						stragglers.emplace_back(system, pieces[j]);
+					else
+						next = std::min(next, deadline);
+				}
+			}
+
+			//--------
+			// DUPLICATE THE STRAGGLERS TO IDLE SYSTEMS
+			//--------
+			for (size_t i = 0; i < stragglers.size(); i++)
+			{
+				// THE IDLE SYSTEM; NOT PROCESSING THE UID AND HAVING THE LEAST PROGRESS
+				ParallelSystem *idle = nullptr;
+				size_t idle_progress = 0;
 
-			return threads.size();
+				for (size_t j = 0; j < systems.size(); j++)
+				{
+					ParallelSystem *system = systems[j].get();
+					if (system->_Is_excluded() == true || system->_Count_progress(uid) != 0)
+						continue;
+
+					size_t progress = system->_Count_progress();
+					if (idle == nullptr
+						|| progress < idle_progress
+						|| (progress == idle_progress && system->getPerformance() > idle->getPerformance()))
+					{
+						idle = system;
+						idle_progress = progress;
+					}
+				}
+				if (idle == nullptr)
+					break;
+
+				std::shared_ptr<protocol::Invoke> invoke = stragglers[i].second.first;
+				std::shared_ptr<PRInvokeHistory> progress = std::dynamic_pointer_cast<PRInvokeHistory>(stragglers[i].second.second);
+
+				idle->sendFrame(enroll_twin(stragglers[i].first, invoke, progress, idle));
+			}
+
+			//--------
+			// CHECK AGAIN AT THE NEXT DEADLINE
+			//--------
+			if (next != std::chrono::system_clock::time_point::max() && speculation->scheduled == false)
+			{
+				speculation->scheduled = true;
+				_Schedule(std::chrono::duration_cast<std::chrono::steady_clock::duration>(next - now), [this, uid]()
+				{
+					std::unique_lock<std::recursive_mutex> uk(_Get_state_mutex());
+
+					auto it = speculations_.find(uid);
+					if (it == speculations_.end())
+						return;
+
+					it->second->scheduled = false;
+					speculate(uid);
+				});
+			}
 		};
 
+	public:
 		/* ---------------------------------------------------------
 			PERFORMANCE ESTIMATION - INTERNAL METHODS
 		--------------------------------------------------------- */
+		virtual auto _Pull_piece(ParallelSystem *system, size_t uid) -> bool override
+		{
+			// NOT IN THE DYNAMIC MODE OR NO CHUNK REMAINED
+			auto it = chunk_queues_.find(uid);
+			if (it == chunk_queues_.end())
+				return false;
+			else if (system->_Is_excluded() == true)
+			{
+				// AN EXCLUDED SYSTEM DOES NOT PULL; HAND THE CHUNKS TO THE IDLE ONES, OR FAIL THEM IF STRANDED
+				std::vector<std::pair<std::shared_ptr<ParallelSystem>, std::shared_ptr<const protocol::InvokeFrame>>> orders = dispatch_chunks(uid, parallel_systems());
+				for (size_t i = 0; i < orders.size(); i++)
+					orders[i].first->sendFrame(orders[i].second);
+
+				return false;
+			}
+
+			std::shared_ptr<const protocol::InvokeFrame> frame = pop_chunk(system, it->second);
+			if (it->second->empty() == true)
+			{
+				std::shared_ptr<ChunkQueue> queue = it->second;
+				chunk_queues_.erase(it);
+				retire_queue(queue);
+			}
+
+			system->sendFrame(frame);
+			return true;
+		};
+
+		virtual auto _Settle_speculation(ParallelSystem *system, std::shared_ptr<slave::InvokeHistory> $progress) -> bool override
+		{
+			std::shared_ptr<PRInvokeHistory> progress = std::dynamic_pointer_cast<PRInvokeHistory>($progress);
+			if (progress == nullptr)
+				return true;
+
+			auto it = speculations_.find(progress->getUID());
+			if (it == speculations_.end())
+				return true;
+
+			std::shared_ptr<Speculation> speculation = it->second;
+			auto twin_it = speculation->twins.find(progress->getFirst());
+
+			// BOTH TWINS HAVE REPORTED CONCURRENTLY, BUT THE OTHER ONE HAS WON
+			if (twin_it == speculation->twins.end())
+			{
+				auto winner_it = speculation->winners.find(progress->getFirst());
+				if (winner_it != speculation->winners.end() && winner_it->second != system)
+					return false;
+			}
+
+			// ARCHIVE THE DONE PIECE
+			speculation->done++;
+
+			if (progress->_Is_speculative() == false)
+			{
+				speculation->elapsed_sum += (double)(_Now() - progress->getStartTime()).count();
+				speculation->elapsed_count++;
+			}
+
+			// CANCEL THE TWIN, WHO HAS LOST
+			if (twin_it != speculation->twins.end())
+			{
+				ParallelSystem *twin = (twin_it->second.first == system) ? twin_it->second.second : twin_it->second.first;
+				speculation->twins.erase(twin_it);
+				speculation->winners.set(progress->getFirst(), system);
+
+				twin->_Cancel_history(progress->getUID(), progress->getFirst());
+			}
+
+			// FIND STRAGGLERS
+			speculate(progress->getUID());
+			return true;
+		};
+
+		virtual auto _Promote_speculation(ParallelSystem *system, std::shared_ptr<slave::InvokeHistory> $progress) -> bool override
+		{
+			std::shared_ptr<PRInvokeHistory> progress = std::dynamic_pointer_cast<PRInvokeHistory>($progress);
+			if (progress == nullptr)
+				return false;
+
+			auto it = speculations_.find(progress->getUID());
+			if (it == speculations_.end())
+				return progress->_Is_speculative(); // DUPLICATE ONLY BE DROPPED
+
+			auto twin_it = it->second->twins.find(progress->getFirst());
+			if (twin_it == it->second->twins.end())
+				return progress->_Is_speculative();
+
+			ParallelSystem *twin = (twin_it->second.first == system) ? twin_it->second.second : twin_it->second.first;
+			it->second->twins.erase(twin_it);
+
+			// THE TWIN TAKES OVER THE ORIGINAL
+			std::unique_lock<std::mutex> pk(twin->_Get_progress_mutex());
+
+			auto range = twin->_Get_progress_list().equal_range(progress->getUID());
+			for (auto p = range.first; p != range.second; p++)
+			{
+				std::shared_ptr<PRInvokeHistory> twin_progress = std::dynamic_pointer_cast<PRInvokeHistory>(p->second.second);
+				if (twin_progress != nullptr && twin_progress->getFirst() == progress->getFirst())
+					twin_progress->_Set_speculative(false);
+			}
+			return true;
+		};
+
+		virtual void _Reduce_piece(size_t uid, std::shared_ptr<protocol::InvokeParameter> result) override
+		{
+			auto it = reductions_.find(uid);
+			if (it == reductions_.end() || result == nullptr)
+				return;
+
+			std::shared_ptr<Reduction> reduction = it->second;
+			if (reduction->reducer == nullptr || reduction->error != nullptr)
+				return;
+
+			// MERGE AS ARRIVED
+			try
+			{
+				if (reduction->value == nullptr)
+					reduction->value = result;
+				else
+					reduction->value = reduction->reducer->reduce(reduction->value, result);
+			}
+			catch (...)
+			{
+				reduction->error = std::current_exception();
+			}
+		};
+
+		/**
+		 * Fail a piece.
+		 *
+		 * The reduction of the process is rejected with the *error* when the process completes; results of the other
+		 * pieces are not merged anymore. A process without reduction completes without the piece.
+		 *
+		 * Called with the {@link _Get_state_mutex state mutex}.
+		 *
+		 * @param uid Unique ID of the process.
+		 * @param error Reason of the failure.
+		 */
+		virtual void _Fail_piece(size_t uid, std::exception_ptr error) override
+		{
+			auto it = reductions_.find(uid);
+			if (it == reductions_.end() || it->second->error != nullptr)
+				return;
+
+			it->second->error = error;
+		};
+
+		/**
+		 * @hidden
+		 */
+		auto _Get_reduced_value(size_t uid) const -> std::shared_ptr<protocol::InvokeParameter>
+		{
+			auto it = reductions_.find(uid);
+			if (it == reductions_.end())
+				return nullptr;
+			else if (it->second->error == nullptr)
+				return it->second->value;
+
+			// FAILED; REPORTED TO THE MASTER AS AN ERROR
+			try
+			{
+				std::rethrow_exception(it->second->error);
+			}
+			catch (std::exception &e)
+			{
+				return std::make_shared<protocol::InvokeParameter>("_Error", std::string(e.what()));
+			}
+			catch (...)
+			{
+				return std::make_shared<protocol::InvokeParameter>("_Error", std::string("Unknown error."));
+			}
+		};
+
 		virtual auto _Complete_history(std::shared_ptr<slave::InvokeHistory> history) -> bool
 		{
 			// WRONG TYPE
 			if (std::dynamic_pointer_cast<PRInvokeHistory>(history) == nullptr)
 				return false;
 
-			//========
-			// READ LOCK
-			//========
+			// ALL THE SUB-TASKS ARE DONE; THE LAST OUTSTANDING PIECE HAS RETIRED
 			size_t uid = history->getUID();
-
-			// ALL THE SUB-TASKS ARE DONE?
-			for (size_t i = 0; i < size(); i++)
-				if (at(i)->_Get_progress_list().has(uid) == true)
-					return false; // IT'S ON A PROCESS IN SOME SYSTEM.
+			speculations_.erase(uid);
+			settle_reduction(uid);
 
 			//--------
 			// RE-CALCULATE PERFORMANCE INDEX
@@ -263,11 +1374,12 @@ namespace parallel
 			std::vector<std::pair<std::shared_ptr<ParallelSystem>, double>> system_pairs;
 			double performance_index_average = 0.0;
 
-			system_pairs.reserve(size());
+			std::vector<std::shared_ptr<ParallelSystem>> systems = parallel_systems();
+			system_pairs.reserve(systems.size());
 
-			for (size_t i = 0; i < size(); i++)
+			for (size_t i = 0; i < systems.size(); i++)
 			{
-				std::shared_ptr<ParallelSystem> system = at(i);
+				std::shared_ptr<ParallelSystem> system = systems[i];
 				if (system->_Get_history_list().has(uid) == false)
 					continue; // NO HISTORY (HAVE NOT PARTICIPATED IN THE PARALLEL PROCESS)
 
@@ -281,6 +1393,23 @@ namespace parallel
 			}
 			performance_index_average /= system_pairs.size();
 
+			// IF ALL THE COST MODELS ARE CONFIDENT, USE THEIR RATES; THROUGHPUTS EXCLUDING OVERHEADS
+			bool modeled = (system_pairs.empty() == false);
+			for (size_t i = 0; i < system_pairs.size(); i++)
+				if (system_pairs[i].first->getCostModel().getConfidence() < .5)
+					modeled = false;
+
+			if (modeled == true)
+			{
+				performance_index_average = 0.0;
+				for (size_t i = 0; i < system_pairs.size(); i++)
+				{
+					system_pairs[i].second = system_pairs[i].first->getCostModel().getRate();
+					performance_index_average += system_pairs[i].second;
+				}
+				performance_index_average /= system_pairs.size();
+			}
+
 			// RE-CALCULATE PERFORMANCE INDEX
 			for (size_t i = 0; i < system_pairs.size(); i++)
 			{
@@ -290,13 +1419,19 @@ namespace parallel
 					continue; // PERFORMANCE INDEX IS ENFORCED. DOES NOT PERMIT REVALUATION
 
 				double new_performance = system_pairs[i].second / performance_index_average;
+				if (modeled == true)
+				{
+					// THE COST MODEL HAS ALREADY SMOOTHED OBSERVATIONS
+					system->setPerformance(new_performance);
+					continue;
+				}
 
 				// DEDUCT RATIO TO REFLECT THE NEW PERFORMANCE INDEX
 				double ordinary_ratio;
-				if (system->_Get_history_list().size() < 2)
+				if (system->_Get_history_list().count() < 2)
 					ordinary_ratio = .3;
 				else
-					ordinary_ratio = std::min<double>(0.7, 1.0 / (system->_Get_history_list().size() - 1.0));
+					ordinary_ratio = std::min<double>(0.7, 1.0 / (system->_Get_history_list().count() - 1.0));
 
 				system->setPerformance((system->getPerformance() * ordinary_ratio) + (new_performance * (1 - ordinary_ratio)));
 			}
@@ -306,16 +1441,50 @@ namespace parallel
 			return true;
 		};
 
+	private:
+		void settle_reduction(size_t uid)
+		{
+			auto it = reductions_.find(uid);
+			if (it == reductions_.end())
+				return;
+
+			std::shared_ptr<Reduction> reduction = it->second;
+			reductions_.erase(it);
+
+			// IN A MEDIATOR, THE VALUE HAS BEEN TAKEN TO BE REPORTED
+			if (reduction->resolve == nullptr)
+				return;
+
+			if (reduction->error != nullptr)
+				reduction->reject(reduction->error);
+			else if (reduction->value == nullptr)
+				reduction->reject(std::make_exception_ptr(std::length_error("No partial result has been reported.")));
+			else
+			{
+				try
+				{
+					reduction->resolve(reduction->value);
+				}
+				catch (...)
+				{
+					// FAILED TO CONVERT THE VALUE
+					reduction->reject(std::current_exception());
+				}
+			}
+		};
+
 	protected:
 		virtual void _Normalize_performance()
 		{
+			std::vector<std::shared_ptr<ParallelSystem>> systems = parallel_systems();
+
 			// COMPUTE AVERAGE
 			double average = 0.0;
 			size_t denominator = 0;
 
-			for (size_t i = 0; i < size(); i++)
+			for (size_t i = 0; i < systems.size(); i++)
 			{
-				std::shared_ptr<ParallelSystem> system = at(i);
+				std::shared_ptr<ParallelSystem> system = systems[i];
 				if (system->_Is_enforced() == true)
 					continue; // PERFORMANCE INDEX IS ENFORCED. DOES NOT PERMIT REVALUATION
 
@@ -325,9 +1494,9 @@ namespace parallel
 			average /= (double)denominator;
 
 			// DIVIDE FROM THE AVERAGE
-			for (size_t i = 0; i < size(); i++)
+			for (size_t i = 0; i < systems.size(); i++)
 			{
-				std::shared_ptr<ParallelSystem> system = at(i);
+				std::shared_ptr<ParallelSystem> system = systems[i];
 				if (system->_Is_enforced() == true)
 					continue; // PERFORMANCE INDEX IS ENFORCED. DOES NOT PERMIT REVALUATION
 
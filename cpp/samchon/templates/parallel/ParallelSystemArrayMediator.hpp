@@ -130,9 +130,12 @@ namespace parallel
 		--------------------------------------------------------- */
 		virtual auto _Complete_history(std::shared_ptr<slave::InvokeHistory> history) -> bool override
 		{
+			// PRE-REDUCED RESULT, TO BE REPORTED TO THE MASTER
+			std::shared_ptr<protocol::InvokeParameter> result = this->_Get_reduced_value(history->getUID());
+
 			bool ret = super::_Complete_history(history);
 			if (ret == true)
-				mediator_->_Complete_history(history->getUID());
+				mediator_->_Complete_history(history->getUID(), result);
 
 			return ret;
 		};
@@ -0,0 +1,55 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <vector>
+#include <samchon/IndexPair.hpp>
+#include <samchon/templates/parallel/CostModel.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace parallel
+{
+	/**
+	 * An abstract partitioner.
+	 *
+	 * The {@link Partitioner} divides a *range of pieces [first, last)* requested by 
+	 * {@link ParallelSystemArray.sendPieceData} into *ranges of sub-pieces*, to be allocated to the 
+	 * {@link ParallelSystem} objects basis on their {@link ParallelSystem.getPerformance performance indices}.
+	 *
+	 * Every index in the *range of pieces* must be covered by exactly one *range of sub-pieces*. Override
+	 * {@link partition} to define a custom dividing strategy and configure it with 
+	 * {@link ParallelSystemArray.setPartitioner}.
+	 *
+	 * - {@link WeightedPartitioner}: one range for each system, proportional to the performance index.
+	 * - {@link OverDecomposedPartitioner}: *k* ranges for each system.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class Partitioner
+	{
+	public:
+		/**
+		 * Default Destructor.
+		 */
+		virtual ~Partitioner() = default;
+
+		/**
+		 * Divide a range of pieces.
+		 *
+		 * @param performances Performance indices of the systems to allocate.
+		 * @param models {@link CostModel Cost models} of the systems, in same order with *performances*. Can be 
+		 *				 empty, then only the *performances* are considered.
+		 * @param first Initial piece's index.
+		 * @param last Final piece's index, not included.
+		 *
+		 * @return Ranges of sub-pieces, each one paired with index of the system to allocate. Empty ranges are not
+		 *		   contained.
+		 */
+		virtual auto partition(const std::vector<double> &performances, const std::vector<CostModel> &models, size_t first, size_t last) const
+			-> std::vector<IndexPair<std::pair<size_t, size_t>>> = 0;
+	};
+};
+};
+};
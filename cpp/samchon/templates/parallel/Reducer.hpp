@@ -0,0 +1,49 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/InvokeParameter.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace parallel
+{
+	/**
+	 * An abstract reducer.
+	 *
+	 * The {@link Reducer} merges partial results of a *parallel process* requested by
+	 * {@link ParallelSystemArray.reducePieceData}. Each slave sets the partial result of its piece with
+	 * {@link PInvoke.setResult}, and the master merges the partial results by {@link reduce} as they arrive. When
+	 * all the pieces are done, the merged result is delivered to the future.
+	 *
+	 * The partial results arrive in arbitrary order, so that the {@link reduce} must be associative and commutative;
+	 * like sum, minimum or the best solution. {@link MediatorSystem Mediators} pre-reduce partial results of their
+	 * slaves, with a {@link Reducer} registered with the same name by {@link ParallelSystemArray.insertReducer}.
+	 *
+	 * - {@link TypedReducer}: a reducer from a function on a value type.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class Reducer
+	{
+	public:
+		/**
+		 * Default Destructor.
+		 */
+		virtual ~Reducer() = default;
+
+		/**
+		 * Merge two partial results.
+		 *
+		 * @param x A partial result, merged ones until now.
+		 * @param y A partial result, newly arrived.
+		 *
+		 * @return The merged partial result.
+		 */
+		virtual auto reduce(std::shared_ptr<protocol::InvokeParameter> x, std::shared_ptr<protocol::InvokeParameter> y) const
+			-> std::shared_ptr<protocol::InvokeParameter> = 0;
+	};
+};
+};
+};
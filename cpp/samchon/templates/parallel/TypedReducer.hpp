@@ -0,0 +1,74 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/parallel/Reducer.hpp>
+
+#include <functional>
+
+namespace samchon
+{
+namespace templates
+{
+namespace parallel
+{
+	/**
+	 * A reducer from a function.
+	 *
+	 * The {@link TypedReducer} merges partial results by a function on a value type. The value type must be one
+	 * supported by the {@link InvokeParameter}; numbers, ```std::string```, ```ByteArray``` or
+	 * ```std::shared_ptr<library::XML>```. An entity like a packing solution can be exchanged by its XML.
+	 *
+	 * @code
+	 * // KEEP THE MINIMUM COST PACKER
+	 * masterArray->insertReducer("packer", std::make_shared<TypedReducer<std::shared_ptr<library::XML>>>
+	 * (
+	 *	[](const std::shared_ptr<library::XML> &x, const std::shared_ptr<library::XML> &y)
+	 *	{
+	 *		Packer a, b;
+	 *		a.construct(x);
+	 *		b.construct(y);
+	 *
+	 *		return (a.calcPrice() <= b.calcPrice()) ? x : y;
+	 *	}
+	 * ));
+	 * @endcode
+	 *
+	 * @tparam T Type of the partial results.
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <typename T>
+	class TypedReducer
+		: public Reducer
+	{
+	private:
+		std::function<T(const T&, const T&)> func_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from a function.
+		 *
+		 * @param func A function merging two partial results, associative and commutative.
+		 */
+		TypedReducer(std::function<T(const T&, const T&)> func)
+		{
+			func_ = func;
+		};
+		virtual ~TypedReducer() = default;
+
+		/* ---------------------------------------------------------
+			REDUCTION
+		--------------------------------------------------------- */
+		virtual auto reduce(std::shared_ptr<protocol::InvokeParameter> x, std::shared_ptr<protocol::InvokeParameter> y) const
+			-> std::shared_ptr<protocol::InvokeParameter> override
+		{
+			T val = func_(x->getValue<T>(), y->getValue<T>());
+
+			return std::make_shared<protocol::InvokeParameter>("result", val);
+		};
+	};
+};
+};
+};
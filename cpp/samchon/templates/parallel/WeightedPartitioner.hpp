@@ -0,0 +1,156 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/parallel/Partitioner.hpp>
+
+#include <cmath>
+#include <algorithm>
+
+namespace samchon
+{
+namespace templates
+{
+namespace parallel
+{
+	/**
+	 * A partitioner dividing proportionally to performance indices.
+	 *
+	 * The {@link WeightedPartitioner} allocates a *range of sub-pieces* to each system, whose size is proportional to
+	 * the system's {@link ParallelSystem.getPerformance performance index} normalized by sum of them. The boundaries
+	 * are rounded from the cumulative proportions, so that sizes of the ranges sum up to the *range of pieces* 
+	 * exactly and each one differs from its exact proportion by less than one.
+	 *
+	 * #### Cost models
+	 * If all the systems have {@link CostModel cost models} with enough {@link CostModel.getConfidence confidence},
+	 * the sizes are not proportional to the performance indices, but solved to make the systems finish at the same
+	 * time, considering both terms of the cost models:
+	 *
+	 * ```
+	 * overhead[i] + size[i] / rate[i] = T, for all i where size[i] > 0
+	 * ```
+	 *
+	 * When the segment is small and the overheads dominate, systems with large overhead get less pieces or nothing.
+	 *
+	 * It's the default {@link Partitioner} of {@link ParallelSystemArray}.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class WeightedPartitioner
+		: public Partitioner
+	{
+	private:
+		double min_confidence_;
+
+	public:
+		/**
+		 * Construct from minimum confidence.
+		 *
+		 * @param minConfidence Minimum {@link CostModel.getConfidence confidence} of the cost models to be used.
+		 */
+		WeightedPartitioner(double minConfidence = .5)
+		{
+			min_confidence_ = minConfidence;
+		};
+		virtual ~WeightedPartitioner() = default;
+
+		virtual auto partition(const std::vector<double> &performances, const std::vector<CostModel> &models, size_t first, size_t last) const
+			-> std::vector<IndexPair<std::pair<size_t, size_t>>> override
+		{
+			std::vector<IndexPair<std::pair<size_t, size_t>>> pieces;
+			if (performances.empty() == true || first >= last)
+				return pieces;
+
+			std::vector<size_t> boundaries = compute_boundaries(compute_weights(performances, models, last - first), first, last);
+			for (size_t i = 0; i < performances.size(); i++)
+				if (boundaries[i] < boundaries[i + 1])
+					pieces.emplace_back(i, std::make_pair(boundaries[i], boundaries[i + 1]));
+
+			return pieces;
+		};
+
+	protected:
+		/**
+		 * Compute weights of the systems.
+		 *
+		 * @return Sizes solved from the cost models to finish at the same time, if all of them are confident.
+		 *		   Otherwise, the performance indices.
+		 */
+		auto compute_weights(const std::vector<double> &performances, const std::vector<CostModel> &models, size_t size) const -> std::vector<double>
+		{
+			if (models.size() != performances.size())
+				return performances;
+
+			for (size_t i = 0; i < models.size(); i++)
+				if (models[i].getConfidence() < min_confidence_)
+					return performances;
+
+			// SYSTEMS ORDERED BY OVERHEAD
+			std::vector<size_t> indices(models.size());
+			for (size_t i = 0; i < indices.size(); i++)
+				indices[i] = i;
+
+			std::sort(indices.begin(), indices.end(), [&models](size_t x, size_t y) -> bool
+			{
+				return models[x].getOverhead() < models[y].getOverhead();
+			});
+
+			// FINISH TIME; ADD SYSTEMS WHILE THEIR OVERHEADS ARE LESS THAN IT
+			double sum_rate = 0.0;
+			double sum_overhead_rate = 0.0;
+			double time = 0.0;
+
+			for (size_t k = 0; k < indices.size(); k++)
+			{
+				const CostModel &model = models[indices[k]];
+
+				sum_rate += model.getRate();
+				sum_overhead_rate += model.getOverhead() * model.getRate();
+				time = (size + sum_overhead_rate) / sum_rate;
+
+				if (k == indices.size() - 1 || time <= models[indices[k + 1]].getOverhead())
+					break;
+			}
+
+			// SIZE OF EACH SYSTEM
+			std::vector<double> weights(models.size());
+			for (size_t i = 0; i < models.size(); i++)
+				weights[i] = std::max<double>(0.0, (time - models[i].getOverhead()) * models[i].getRate());
+
+			return weights;
+		};
+
+		/**
+		 * Compute boundaries of the ranges.
+		 *
+		 * @param weights Weights of the systems, sizes of the ranges are proportional to.
+		 * @return Boundaries, where the *i*th system is allocated [boundaries[i], boundaries[i + 1]).
+		 */
+		static auto compute_boundaries(const std::vector<double> &weights, size_t first, size_t last) -> std::vector<size_t>
+		{
+			// NEGATIVE WEIGHTS ARE NOT ALLOWED. IF NOTHING IS POSITIVE, THEN EQUALLY
+			double sum = 0.0;
+			for (size_t i = 0; i < weights.size(); i++)
+				sum += std::max<double>(weights[i], 0.0);
+
+			size_t size = last - first;
+			std::vector<size_t> boundaries(weights.size() + 1, first);
+
+			double cumulative = 0.0;
+			for (size_t i = 0; i < weights.size(); i++)
+			{
+				cumulative += (sum > 0.0) ? std::max<double>(weights[i], 0.0) : 1.0;
+
+				double ratio = cumulative / ((sum > 0.0) ? sum : (double)weights.size());
+				size_t offset = (size_t)std::floor(size * ratio + .5);
+
+				// MONOTONOUS AND BOUNDED
+				boundaries[i + 1] = std::max<size_t>(boundaries[i], first + std::min<size_t>(offset, size));
+			}
+			boundaries.back() = last;
+
+			return boundaries;
+		};
+	};
+};
+};
+};
@@ -2,6 +2,19 @@
 #include <samchon/API.hpp>
 
 #include <samchon/templates/external/base/ExternalSystemArrayBase.hpp>
+#include <samchon/library/ThreadPool.hpp>
+#include <samchon/templates/tracing/Tracer.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <chrono>
+#include <stdexcept>
+#include <exception>
+#include <functional>
+#include <deque>
+#include <unordered_set>
+#include <samchon/HashMap.hpp>
 
 namespace samchon
 {
@@ -14,12 +27,29 @@ namespace slave
 
 namespace parallel
 {
+	class ParallelSystem;
+
 namespace base
 {
 	class ParallelSystemArrayBase
 	{
 	private:
-		size_t history_sequence_{0};
+		// UID = (ORIGIN << SEQUENCE_BITS) | SEQUENCE
+		size_t origin_;
+		std::atomic<size_t> history_sequence_{0};
+		library::ThreadPool executor_;
+		tracing::Tracer tracer_;
+
+		// STATES OF THE PROCESSES ON PROGRESS; NOT THE MEMBERSHIP, WHICH IS GUARDED BY THE getMutex()
+		std::recursive_mutex state_mtx_;
+
+		// NUMBER OF OUTSTANDING PIECES PER UID
+		HashMap<size_t, std::shared_ptr<std::atomic<size_t>>> outstanding_map_;
+		std::mutex outstanding_mtx_;
+
+		// RECENTLY CANCELLED UIDS, NOT TO BE RE-SENT
+		std::unordered_set<size_t> cancelled_set_;
+		std::deque<size_t> cancelled_queue_;
 
 	public:
 		/* ---------------------------------------------------------
@@ -27,6 +57,12 @@ namespace base
 		--------------------------------------------------------- */
 		ParallelSystemArrayBase()
 		{
+			// RANDOM ORIGIN, EXCEPT ZERO
+			std::random_device device;
+			std::mt19937_64 engine(((uint64_t)device() << 32) ^ (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count());
+			std::uniform_int_distribution<size_t> distribution(1, _Max_origin());
+
+			origin_ = distribution(engine);
 			history_sequence_ = 0;
 		};
 		virtual ~ParallelSystemArrayBase() = default;
@@ -34,18 +70,256 @@ namespace base
 		/* ---------------------------------------------------------
 			ACCESSORS
 		--------------------------------------------------------- */
+		/**
+		 * Get origin of the UIDs.
+		 *
+		 * A UID of process, the ```_History_uid``` parameter, is composed of the origin in the upper bits and a 
+		 * sequence in the lower bits. The origin identifies the system array who has issued the UID, thus UIDs stay 
+		 * unique over a hierarchy of masters and mediators. A mediator keeps UIDs issued by its masters.
+		 *
+		 * The origin is random by default.
+		 */
+		auto getOrigin() const -> size_t
+		{
+			return origin_;
+		};
+
+		/**
+		 * Set origin of the UIDs.
+		 *
+		 * Assign distinct origins to the system arrays in a hierarchy, to exclude collision of the random origins. Set
+		 * it before requesting any process.
+		 *
+		 * @param val The origin, in [1, {@link _Max_origin}].
+		 */
+		void setOrigin(size_t val)
+		{
+			if (val == 0 || val > _Max_origin())
+				throw std::out_of_range("Origin is out of range.");
+
+			origin_ = val;
+		};
+
+		/**
+		 * Get the {@link Tracer}, collecting spans of the processes.
+		 *
+		 * {@link Tracer.setEnabled Enable} it to trace the processes requested after, and export the spans with 
+		 * {@link Tracer.save}.
+		 */
+		auto getTracer() -> tracing::Tracer&
+		{
+			return tracer_;
+		};
+
+		/**
+		 * Get number of bits of the sequence in a UID.
+		 *
+		 * The whole UID fits in 52 bits (or the ```size_t```, if narrower), to be exact in the numeric 
+		 * {@link InvokeParameter parameters}, which are converted through ```double```.
+		 */
+		static auto _Sequence_bits() -> size_t
+		{
+			return (sizeof(size_t) >= 8) ? 32 : 24;
+		};
+
+		/**
+		 * Get maximum value of the origin.
+		 */
+		static auto _Max_origin() -> size_t
+		{
+			return ((size_t)1 << ((sizeof(size_t) >= 8) ? 20 : 8)) - 1;
+		};
+
+		/**
+		 * Get number of the issued UIDs.
+		 */
 		auto _Get_history_sequence() const -> size_t
 		{
-			return history_sequence_;
+			return history_sequence_.load();
 		};
+
+		/**
+		 * Issue a UID, without any lock.
+		 *
+		 * @return A new UID composed of the {@link getOrigin origin} and the next sequence.
+		 */
 		auto _Fetch_history_sequence() -> size_t
 		{
-			return ++history_sequence_;
+			size_t sequence = history_sequence_.fetch_add(1) + 1;
+			size_t mask = ((size_t)1 << _Sequence_bits()) - 1;
+
+			return (origin_ << _Sequence_bits()) | (sequence & mask);
+		};
+
+		auto _Get_executor() -> library::ThreadPool&
+		{
+			return executor_;
+		};
+
+		/* ---------------------------------------------------------
+			CLOCK AND TIMERS
+		--------------------------------------------------------- */
+		/**
+		 * Get current time.
+		 *
+		 * Default is the system clock. A {@link simulation::Simulator} replaces it with a virtual clock.
+		 */
+		virtual auto _Now() const -> std::chrono::system_clock::time_point
+		{
+			return std::chrono::system_clock::now();
+		};
+
+		/**
+		 * Get current time of the steady clock, to measure durations.
+		 *
+		 * Default is the steady clock. A {@link simulation::Simulator} replaces it with a virtual clock.
+		 */
+		virtual auto _Steady_now() const -> std::chrono::steady_clock::time_point
+		{
+			return std::chrono::steady_clock::now();
+		};
+
+		/**
+		 * Post a task, to be executed asynchronously.
+		 *
+		 * Default is the {@link _Get_executor executor}.
+		 *
+		 * @param task A task to execute.
+		 */
+		virtual void _Post(std::function<void()> task)
+		{
+			executor_.post(move(task));
 		};
 
-		void _Set_history_sequence(size_t val)
+		/**
+		 * Post a task, to be executed after a delay.
+		 *
+		 * Default is the {@link _Get_executor executor}.
+		 *
+		 * @param delay Delay from now.
+		 * @param task A task to execute.
+		 */
+		virtual void _Schedule(std::chrono::steady_clock::duration delay, std::function<void()> task)
 		{
-			history_sequence_ = val;
+			executor_.schedule(delay, move(task));
+		};
+
+		/**
+		 * Get mutex of the states.
+		 *
+		 * Guards states of the processes on progress; chunk queues, speculations, reductions, histories of the 
+		 * systems and revaluation of the performance indices. Progress lists of the systems are guarded by their own 
+		 * mutexes, which can be locked while holding this mutex, but not vice versa.
+		 *
+		 * It's recursive, because an erased system may be destructed by releasing a snapshot, while this mutex is 
+		 * held. Then the system sends its pieces on progress back, with this mutex.
+		 */
+		auto _Get_state_mutex() -> std::recursive_mutex&
+		{
+			return state_mtx_;
+		};
+
+		/* ---------------------------------------------------------
+			OUTSTANDING PIECES
+		--------------------------------------------------------- */
+		/**
+		 * Enroll an outstanding piece.
+		 *
+		 * @param uid Unique ID of the parallel process.
+		 */
+		void _Enroll_piece(size_t uid)
+		{
+			std::shared_ptr<std::atomic<size_t>> counter;
+			{
+				std::unique_lock<std::mutex> uk(outstanding_mtx_);
+
+				auto it = outstanding_map_.find(uid);
+				if (it == outstanding_map_.end())
+					it = outstanding_map_.emplace(uid, std::make_shared<std::atomic<size_t>>(0)).first;
+
+				counter = it->second;
+			}
+			counter->fetch_add(1);
+		};
+
+		/**
+		 * Retire an outstanding piece.
+		 *
+		 * @param uid Unique ID of the parallel process.
+		 * @return Whether the piece was the last one; the parallel process has completed.
+		 */
+		auto _Retire_piece(size_t uid) -> bool
+		{
+			std::shared_ptr<std::atomic<size_t>> counter;
+			{
+				std::unique_lock<std::mutex> uk(outstanding_mtx_);
+
+				auto it = outstanding_map_.find(uid);
+				if (it == outstanding_map_.end())
+					return false;
+
+				counter = it->second;
+			}
+			if (counter->fetch_sub(1) != 1)
+				return false;
+
+			// THE LAST PIECE; ERASE THE COUNTER UNLESS RE-ENROLLED MEANWHILE
+			std::unique_lock<std::mutex> uk(outstanding_mtx_);
+
+			auto it = outstanding_map_.find(uid);
+			if (it != outstanding_map_.end() && it->second == counter && counter->load() == 0)
+				outstanding_map_.erase(it);
+
+			return true;
+		};
+
+		/**
+		 * Get number of outstanding pieces.
+		 *
+		 * @param uid Unique ID of the parallel process.
+		 */
+		auto _Count_outstanding_pieces(size_t uid) -> size_t
+		{
+			std::unique_lock<std::mutex> uk(outstanding_mtx_);
+
+			auto it = outstanding_map_.find(uid);
+			return (it == outstanding_map_.end()) ? 0 : it->second->load();
+		};
+
+		/**
+		 * Discard outstanding pieces of a cancelled process.
+		 *
+		 * Erases the counter of outstanding pieces, so that the process never completes, and remembers the *uid* so 
+		 * that pieces sent back from disconnected systems are not re-sent.
+		 *
+		 * @param uid Unique ID of the cancelled process.
+		 */
+		void _Discard_pieces(size_t uid)
+		{
+			std::unique_lock<std::mutex> uk(outstanding_mtx_);
+			outstanding_map_.erase(uid);
+
+			if (cancelled_set_.insert(uid).second == false)
+				return;
+
+			// REMEMBER ONLY THE RECENT ONES
+			cancelled_queue_.push_back(uid);
+			if (cancelled_queue_.size() > 1024)
+			{
+				cancelled_set_.erase(cancelled_queue_.front());
+				cancelled_queue_.pop_front();
+			}
+		};
+
+		/**
+		 * Test whether a process has been cancelled.
+		 *
+		 * @param uid Unique ID of the process.
+		 */
+		auto _Is_cancelled(size_t uid) -> bool
+		{
+			std::unique_lock<std::mutex> uk(outstanding_mtx_);
+			return cancelled_set_.count(uid) != 0;
 		};
 
 	public:
@@ -54,7 +328,21 @@ namespace base
 		--------------------------------------------------------- */
 		virtual auto sendPieceData(std::shared_ptr<protocol::Invoke> invoke, size_t first, size_t last) -> size_t = 0;
 
+		virtual auto cancel(size_t uid) -> bool = 0;
+
 		virtual auto _Complete_history(std::shared_ptr<slave::InvokeHistory> history) -> bool = 0;
+
+		virtual auto _Pull_piece(ParallelSystem *system, size_t uid) -> bool = 0;
+
+		virtual void _Reduce_piece(size_t uid, std::shared_ptr<protocol::InvokeParameter> result) = 0;
+
+		virtual void _Fail_piece(size_t uid, std::exception_ptr error) = 0;
+
+		virtual auto _Settle_speculation(ParallelSystem *system, std::shared_ptr<slave::InvokeHistory> progress) -> bool = 0;
+
+		virtual auto _Promote_speculation(ParallelSystem *system, std::shared_ptr<slave::InvokeHistory> progress) -> bool = 0;
+
+		virtual void _Leave_drained(ParallelSystem *system) = 0;
 	};
 };
 };
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <samchon/templates/simulation/Simulator.hpp>
+#include <samchon/templates/simulation/SimulatedSystem.hpp>
+#include <samchon/templates/simulation/VirtualClock.hpp>
+
+#include <samchon/templates/simulation/SystemProfile.hpp>
+#include <samchon/templates/simulation/SystemReport.hpp>
+#include <samchon/templates/simulation/SimulationReport.hpp>
\ No newline at end of file
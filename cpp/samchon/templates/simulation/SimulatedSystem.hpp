@@ -0,0 +1,367 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/simulation/VirtualClock.hpp>
+#include <samchon/templates/simulation/SystemProfile.hpp>
+#include <samchon/templates/simulation/SystemReport.hpp>
+
+#include <samchon/templates/external/ExternalSystem.hpp>
+#include <samchon/templates/parallel/PRInvokeHistory.hpp>
+#include <samchon/templates/slave/Backlog.hpp>
+#include <samchon/templates/tracing/SpanArray.hpp>
+#include <samchon/protocol/InvokeFrame.hpp>
+
+#include <deque>
+#include <list>
+#include <atomic>
+#include <random>
+
+namespace samchon
+{
+namespace templates
+{
+namespace simulation
+{
+	/**
+	 * A simulated slave system.
+	 *
+	 * The {@link SimulatedSystem} replaces the remote slave of a {@link ParallelSystem} or {@link DistributedSystem} in
+	 * a {@link Simulator}. Messages sent to it do not go to a network, but arrive after the
+	 * {@link SystemProfile.getLatency latency} of the {@link VirtualClock}. Processes requested are queued and computed
+	 * by the {@link SystemProfile.getWorkers workers} in virtual time, as described in the {@link SystemProfile}, and
+	 * reported back to the master with the {@link Backlog}, just like a {@link SlaveSystem}.
+	 *
+	 * Nothing is computed for real. The ```replyData()``` of the slave is not called, thus reports do not have partial
+	 * results; blobs are not delivered. Messages other than processes (having ```_History_uid```), cancellations and
+	 * pings are ignored. Spans are recorded for the {@link Tracer}, if requested.
+	 *
+	 * The *System* must be default constructible.
+	 *
+	 * @tparam System A type of the {@link ParallelSystem} to simulate, or a class derived from it.
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <class System>
+	class SimulatedSystem
+		: public System
+	{
+	private:
+		typedef System super;
+
+		struct Task
+		{
+			std::shared_ptr<slave::InvokeHistory> history;
+			std::shared_ptr<tracing::SpanArray> trace;
+			std::chrono::system_clock::time_point received;
+			size_t first;
+			double work;
+			double started;
+			bool cancelled;
+		};
+
+		VirtualClock *clock_;
+		SystemProfile profile_;
+		std::shared_ptr<SystemReport> report_;
+
+		// EVENTS OF THE CLOCK REFER THIS FLAG, NOT TO TOUCH A DESTRUCTED OR FAILED SYSTEM
+		std::shared_ptr<std::atomic<bool>> alive_;
+
+		std::deque<std::shared_ptr<Task>> queue_;
+		std::list<std::shared_ptr<Task>> running_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from parent array, clock and profile.
+		 *
+		 * @param systemArray The parent {@link ParallelSystemArray} object.
+		 * @param clock The {@link VirtualClock} of the {@link Simulator}.
+		 * @param profile Profile of the system.
+		 */
+		SimulatedSystem(external::base::ExternalSystemArrayBase *systemArray, VirtualClock *clock, const SystemProfile &profile)
+			: super()
+		{
+			this->system_array_ = systemArray;
+			this->name = profile.getName();
+
+			clock_ = clock;
+			profile_ = profile;
+			report_.reset(new SystemReport(profile.getName(), profile.getWorkers()));
+			alive_.reset(new std::atomic<bool>(true));
+		};
+		virtual ~SimulatedSystem()
+		{
+			*alive_ = false;
+		};
+
+	protected:
+		virtual auto createChild(std::shared_ptr<library::XML>) -> external::ExternalSystemRole* override
+		{
+			return nullptr;
+		};
+
+	public:
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		auto getProfile() const -> const SystemProfile&
+		{
+			return profile_;
+		};
+
+		/**
+		 * Get statistics of the system, recorded until now.
+		 */
+		auto getReport() const -> std::shared_ptr<SystemReport>
+		{
+			return report_;
+		};
+
+		/**
+		 * Whether the system is alive; not failed.
+		 */
+		auto isAlive() const -> bool
+		{
+			return *alive_;
+		};
+
+		/**
+		 * Halt the system, as if the remote slave has crashed.
+		 *
+		 * Messages on the way and processes on progress are lost. Erase the system from its parent after the halt, to
+		 * send the processes back to other systems.
+		 */
+		void _Halt()
+		{
+			*alive_ = false;
+			report_->_Record_failure(_Elapsed());
+		};
+
+		/* ---------------------------------------------------------
+			NETWORK & MESSAGE CHAIN
+		--------------------------------------------------------- */
+		virtual void sendData(std::shared_ptr<protocol::Invoke> invoke) override
+		{
+			_Deliver(invoke);
+		};
+
+		virtual void sendFrame(std::shared_ptr<const protocol::InvokeFrame> frame) override
+		{
+			_Deliver(frame->getInvoke());
+		};
+
+	protected:
+		/**
+		 * Deliver a message to the simulated slave, after the latency.
+		 */
+		void _Deliver(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			if (*alive_ == false)
+				return;
+
+			std::shared_ptr<std::atomic<bool>> alive = alive_;
+			clock_->post(VirtualClock::seconds(profile_.getLatency()), [this, alive, invoke]()
+			{
+				if (*alive == true)
+					_Receive(invoke);
+			});
+		};
+
+		/**
+		 * Handle a message arrived at the simulated slave.
+		 *
+		 * @param invoke An {@link Invoke} message sent by the master.
+		 */
+		virtual void _Receive(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			if (invoke->getListener() == "_Cancel_history")
+			{
+				size_t uid = invoke->front()->getValue<size_t>();
+				size_t first = (invoke->size() > 1) ? invoke->at(1)->getValue<size_t>() : (size_t)-1;
+
+				_Cancel(uid, first);
+				return;
+			}
+			else if (invoke->getListener() == "_Ping")
+			{
+				_Pong(invoke);
+				return;
+			}
+			else if (invoke->has("_History_uid") == false)
+				return;
+
+			// HISTORY, WITH RANGE OF PIECES TO BE IDENTIFIED BY THE MASTER
+			std::shared_ptr<Task> task(new Task());
+			if (invoke->has("_Piece_first") == true)
+			{
+				std::shared_ptr<parallel::PRInvokeHistory> history(new parallel::PRInvokeHistory(invoke));
+				task->history = history;
+				task->first = history->getFirst();
+				task->work = (double)(history->getLast() - history->getFirst());
+			}
+			else
+			{
+				task->history.reset(new slave::InvokeHistory(invoke));
+				task->first = (size_t)-1;
+				task->work = invoke->has("_Process_weight")
+					? invoke->get("_Process_weight")->getValue<double>()
+					: 1.0;
+			}
+			task->received = clock_->now();
+			task->started = 0.0;
+			task->cancelled = false;
+
+			// SPANS REQUESTED BY THE MASTER, FROM NOW
+			if (invoke->has("_Trace") == true)
+			{
+				task->trace.reset(new tracing::SpanArray());
+				task->trace->setReceived(task->received);
+			}
+
+			queue_.push_back(task);
+			_Dispatch();
+		};
+
+		/**
+		 * Reply a ```_Pong``` to a ```_Ping``` at once, after the latency.
+		 */
+		void _Pong(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			std::shared_ptr<protocol::Invoke> pong(new protocol::Invoke("_Pong"));
+			pong->emplace_back(new protocol::InvokeParameter("seq", invoke->front()->getValue<size_t>()));
+			pong->emplace_back(new protocol::InvokeParameter("received", tracing::Span::_Micro(clock_->now())));
+			pong->emplace_back(new protocol::InvokeParameter("held", (long long)0));
+
+			std::shared_ptr<std::atomic<bool>> alive = alive_;
+			clock_->post(VirtualClock::seconds(profile_.getLatency()), [this, alive, pong]()
+			{
+				if (*alive == true)
+					this->_Reply_data(pong);
+			});
+		};
+
+		/**
+		 * Start processes waiting, as many as the idle workers.
+		 */
+		void _Dispatch()
+		{
+			while (running_.size() < profile_.getWorkers() && queue_.empty() == false)
+			{
+				std::shared_ptr<Task> task = queue_.front();
+				queue_.pop_front();
+
+				// SERVICE TIME
+				double elapsed = _Elapsed();
+				double seconds = profile_.getOverhead() + task->work / profile_.getSpeed();
+
+				if (profile_.getSlowdownAt() >= 0.0 && elapsed >= profile_.getSlowdownAt())
+					seconds *= profile_.getSlowdown();
+				if (profile_.getJitter() > 0.0)
+					seconds *= std::lognormal_distribution<double>(0.0, profile_.getJitter())(clock_->getEngine());
+
+				task->started = elapsed;
+				task->history->setStartTime(library::Date(clock_->now()));
+				running_.push_back(task);
+
+				if (task->trace != nullptr)
+					task->trace->emplace_back(new tracing::Span("queue", "", task->history->getUID(), task->received, clock_->now()));
+
+				std::shared_ptr<std::atomic<bool>> alive = alive_;
+				clock_->post(VirtualClock::seconds(seconds), [this, alive, task]()
+				{
+					if (*alive == true && task->cancelled == false)
+						_Complete(task);
+				});
+			}
+		};
+
+		/**
+		 * Report a completed process to the master, after the latency.
+		 */
+		void _Complete(std::shared_ptr<Task> task)
+		{
+			running_.remove(task);
+
+			double elapsed = _Elapsed();
+			report_->_Record_process(task->work, elapsed - task->started, elapsed + profile_.getLatency());
+
+			// REPORT WITH BACKLOG
+			task->history->setEndTime(library::Date(clock_->now()));
+			task->history->_Set_elapsed_time(std::chrono::duration_cast<std::chrono::nanoseconds>(task->history->getEndTime() - task->history->getStartTime()));
+
+			std::shared_ptr<protocol::Invoke> report = task->history->toInvoke();
+			if (task->trace != nullptr)
+			{
+				task->trace->emplace_back(new tracing::Span("handler", "", task->history->getUID(), task->history->getStartTime(), task->history->getEndTime()));
+				task->trace->setSent(clock_->now());
+
+				report->emplace_back(new protocol::InvokeParameter("_Trace", task->trace->toXML()));
+			}
+			report->emplace_back(new protocol::InvokeParameter("_Backlog", _Get_backlog().toXML()));
+
+			std::shared_ptr<std::atomic<bool>> alive = alive_;
+			clock_->post(VirtualClock::seconds(profile_.getLatency()), [this, alive, report]()
+			{
+				if (*alive == true)
+					this->_Reply_data(report);
+			});
+
+			_Dispatch();
+		};
+
+		/**
+		 * Cancel processes.
+		 *
+		 * Processes waiting are removed from the queue. Processes running stop at once, as cooperative slaves do, and
+		 * release their workers.
+		 *
+		 * @param uid Unique ID of the process.
+		 * @param first Initial index of the piece to cancel. Default is all the pieces having the *uid*.
+		 */
+		void _Cancel(size_t uid, size_t first)
+		{
+			auto match = [uid, first](const std::shared_ptr<Task> &task) -> bool
+			{
+				return task->history->getUID() == uid && (first == (size_t)-1 || task->first == first);
+			};
+
+			for (auto it = queue_.begin(); it != queue_.end();)
+				if (match(*it) == true)
+					it = queue_.erase(it);
+				else
+					it++;
+
+			double elapsed = _Elapsed();
+			for (auto it = running_.begin(); it != running_.end();)
+				if (match(*it) == true)
+				{
+					(*it)->cancelled = true;
+					report_->_Record_cancellation(elapsed - (*it)->started);
+
+					it = running_.erase(it);
+				}
+				else
+					it++;
+
+			_Dispatch();
+		};
+
+		/**
+		 * Get backlog, to be reported to the master.
+		 */
+		auto _Get_backlog() const -> slave::Backlog
+		{
+			size_t workers = profile_.getWorkers();
+			return slave::Backlog(workers, queue_.size(), running_.size(), (double)running_.size() / (double)workers);
+		};
+
+	private:
+		auto _Elapsed() const -> double
+		{
+			return std::chrono::duration<double>(clock_->now().time_since_epoch()).count();
+		};
+	};
+};
+};
+};
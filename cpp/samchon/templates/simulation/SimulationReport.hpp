@@ -0,0 +1,110 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/SharedEntityArray.hpp>
+#include <samchon/templates/simulation/SystemReport.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace simulation
+{
+	/**
+	 * Report of a simulation.
+	 *
+	 * The {@link SimulationReport} is a result of {@link Simulator.run}; {@link SystemReport reports of the systems}
+	 * with the makespan, time from start of the simulation to the last report, and overall utilization of the workers.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class SimulationReport
+		: public protocol::SharedEntityArray<SystemReport>
+	{
+	private:
+		typedef protocol::SharedEntityArray<SystemReport> super;
+
+		double makespan_{ 0.0 };
+		double utilization_{ 0.0 };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		using super::super;
+		virtual ~SimulationReport() = default;
+
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			makespan_ = xml->getProperty<double>("makespan");
+			utilization_ = xml->getProperty<double>("utilization");
+
+			super::construct(xml);
+		};
+
+	protected:
+		virtual auto createChild(std::shared_ptr<library::XML>) -> SystemReport* override
+		{
+			return new SystemReport();
+		};
+
+	public:
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get makespan, seconds from start of the simulation to the last report.
+		 */
+		auto getMakespan() const -> double
+		{
+			return makespan_;
+		};
+
+		/**
+		 * Get overall utilization of the workers, in [0, 1].
+		 */
+		auto getUtilization() const -> double
+		{
+			return utilization_;
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Set_makespan(double val)
+		{
+			makespan_ = val;
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Set_utilization(double val)
+		{
+			utilization_ = val;
+		};
+
+		/* ---------------------------------------------------------
+			EXPORTERS
+		--------------------------------------------------------- */
+		virtual auto TAG() const -> std::string override
+		{
+			return "simulation";
+		};
+		virtual auto CHILD_TAG() const -> std::string override
+		{
+			return "system";
+		};
+
+		virtual auto toXML() const -> std::shared_ptr<library::XML> override
+		{
+			std::shared_ptr<library::XML> xml = super::toXML();
+			xml->setProperty("makespan", makespan_);
+			xml->setProperty("utilization", utilization_);
+
+			return xml;
+		};
+	};
+};
+};
+};
@@ -0,0 +1,281 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/simulation/VirtualClock.hpp>
+#include <samchon/templates/simulation/SimulatedSystem.hpp>
+#include <samchon/templates/simulation/SimulationReport.hpp>
+
+#include <vector>
+#include <shared_mutex>
+#include <algorithm>
+
+namespace samchon
+{
+namespace templates
+{
+namespace simulation
+{
+	/**
+	 * A deterministic simulator of a parallel processing system.
+	 *
+	 * The {@link Simulator} runs a real master, a {@link ParallelSystemArray} or {@link DistributedSystemArray} with
+	 * its allocation, speculation, cancellation and send-back of pieces, against {@link SimulatedSystem simulated
+	 * slaves} in virtual time. Clock and timers of the master are replaced with a {@link VirtualClock}, thus a scenario
+	 * of hours is simulated in a moment and a same seed reproduces a same result.
+	 *
+	 * - {@link insert} slaves with their {@link SystemProfile profiles}; speed, latency, jitter and faults.
+	 * - {@link post} steps of the scenario, such as ```sendPieceData()``` or ```sendData()```, with their delays.
+	 * - {@link run} the scenario and get the {@link SimulationReport report}; makespan, utilization and performance
+	 *	 indices estimated by the master.
+	 *
+	 * ```cpp
+	 * Simulator<MyParallelSystemArray> simulator(7);
+	 * simulator.insert(SystemProfile("fast", 2000));
+	 * simulator.insert(SystemProfile("slow", 500));
+	 *
+	 * simulator.post(0.0, [](MyParallelSystemArray &array)
+	 * {
+	 *	array.sendSegmentData(std::make_shared<protocol::Invoke>("compute"), 100000);
+	 * });
+	 * std::shared_ptr<SimulationReport> report = simulator.run();
+	 * ```
+	 *
+	 * The *Array* must be a concrete and default constructible class, and its *System* (```child_type```) must be
+	 * default constructible. The events are executed by the caller of {@link run}, one at a time; do not call the
+	 * master from other threads while running. Selectors having their own random engines, like
+	 * {@link PowerOfTwoSelector}, should be seeded also to be deterministic.
+	 *
+	 * @tparam Array A type of the {@link ParallelSystemArray} to simulate.
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <class Array>
+	class Simulator
+	{
+	public:
+		typedef typename Array::child_type System;
+
+	private:
+		/**
+		 * @hidden
+		 */
+		class SimulatedArray
+			: public Array
+		{
+		private:
+			VirtualClock *clock_;
+
+		public:
+			SimulatedArray(VirtualClock *clock)
+				: Array()
+			{
+				clock_ = clock;
+			};
+
+			virtual auto _Now() const -> std::chrono::system_clock::time_point override
+			{
+				return clock_->now();
+			};
+
+			virtual auto _Steady_now() const -> std::chrono::steady_clock::time_point override
+			{
+				return std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(clock_->now().time_since_epoch()));
+			};
+
+			virtual void _Post(std::function<void()> task) override
+			{
+				clock_->post(std::chrono::system_clock::duration::zero(), move(task));
+			};
+
+			virtual void _Schedule(std::chrono::steady_clock::duration delay, std::function<void()> task) override
+			{
+				clock_->post(std::chrono::duration_cast<std::chrono::system_clock::duration>(delay), move(task));
+			};
+		};
+
+		// THE CLOCK OUTLIVES THE ARRAY
+		VirtualClock clock_;
+		SimulatedArray array_;
+
+		// SYSTEMS INSERTED, INCLUDING THE FAILED ONES
+		std::vector<std::pair<std::weak_ptr<SimulatedSystem<System>>, std::shared_ptr<SystemReport>>> members_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from seed.
+		 *
+		 * @param seed Seed of the {@link VirtualClock.getEngine random engine}, for jitters.
+		 */
+		Simulator(unsigned int seed = 0)
+			: clock_(seed),
+			array_(&clock_)
+		{
+			// FIXED ORIGIN OF THE UIDS, TO BE REPRODUCIBLE
+			array_.setOrigin(1);
+		};
+
+		/**
+		 * Destructor.
+		 *
+		 * The systems are destructed before the array. Pieces sent back by them are left in the clock, never executed.
+		 */
+		~Simulator()
+		{
+			std::vector<std::shared_ptr<System>> systems;
+			{
+				std::unique_lock<std::shared_mutex> uk(array_.getMutex());
+
+				systems.assign(array_.begin(), array_.end());
+				array_.clear();
+			}
+		};
+
+		/**
+		 * Insert a simulated system.
+		 *
+		 * The system {@link ParallelSystemArray.join joins} the master, thus inserting during the {@link run} steals
+		 * pieces on progress. If the *profile* has a {@link SystemProfile.getFailAt failure}, the system is halted and
+		 * erased at the time, then its pieces on progress are sent back to other systems by the master.
+		 *
+		 * @param profile Profile of the system.
+		 */
+		void insert(const SystemProfile &profile)
+		{
+			std::shared_ptr<SimulatedSystem<System>> system(new SimulatedSystem<System>(&array_, &clock_, profile));
+			members_.emplace_back(system, system->getReport());
+
+			array_.join(system);
+
+			if (profile.getFailAt() >= 0.0)
+			{
+				std::weak_ptr<SimulatedSystem<System>> weak = system;
+				clock_.post
+				(
+					std::chrono::system_clock::time_point() + VirtualClock::seconds(profile.getFailAt()) - clock_.now(),
+					[this, weak]()
+					{
+						_Fail(weak.lock());
+					}
+				);
+			}
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get the master, simulated.
+		 */
+		auto getArray() -> Array&
+		{
+			return array_;
+		};
+
+		auto getClock() -> VirtualClock&
+		{
+			return clock_;
+		};
+
+		/* ---------------------------------------------------------
+			SCENARIO
+		--------------------------------------------------------- */
+		/**
+		 * Post a step of the scenario.
+		 *
+		 * @param delay Seconds from now, in virtual time.
+		 * @param step A step to execute with the master.
+		 */
+		void post(double delay, std::function<void(Array&)> step)
+		{
+			clock_.post(VirtualClock::seconds(delay), [this, step]()
+			{
+				step(array_);
+			});
+		};
+
+		/**
+		 * Run the scenario.
+		 *
+		 * Executes events in order of virtual time until no event is left, or the *limit* has reached.
+		 *
+		 * @param limit Seconds from start of the simulation. Negative value means no limit.
+		 * @return Report of the simulation, until now.
+		 */
+		auto run(double limit = -1.0) -> std::shared_ptr<SimulationReport>
+		{
+			std::chrono::system_clock::time_point until = (limit < 0.0)
+				? std::chrono::system_clock::time_point::max()
+				: std::chrono::system_clock::time_point() + VirtualClock::seconds(limit);
+
+			while (clock_.step(until) == true)
+				continue;
+
+			return _Report();
+		};
+
+	private:
+		void _Fail(std::shared_ptr<SimulatedSystem<System>> system)
+		{
+			if (system == nullptr)
+				return;
+
+			system->_Halt();
+			system->getReport()->_Record_performance(system->getPerformance());
+			{
+				std::unique_lock<std::shared_mutex> uk(array_.getMutex());
+
+				for (size_t i = 0; i < array_.size(); i++)
+					if (array_.at(i) == system)
+					{
+						array_.erase(array_.begin() + i);
+						break;
+					}
+			}
+
+			// THE LAST REFERENCE IS RELEASED HERE, OUT OF THE LOCK; PIECES ON PROGRESS ARE SENT BACK
+		};
+
+		auto _Report() -> std::shared_ptr<SimulationReport>
+		{
+			std::shared_ptr<SimulationReport> report(new SimulationReport());
+
+			// PERFORMANCE INDICES OF THE LIVE SYSTEMS AND THE MAKESPAN
+			double makespan = 0.0;
+			for (size_t i = 0; i < members_.size(); i++)
+			{
+				std::shared_ptr<SimulatedSystem<System>> system = members_[i].first.lock();
+				if (system != nullptr && system->isAlive() == true)
+					members_[i].second->_Record_performance(system->getPerformance());
+
+				makespan = std::max<double>(makespan, members_[i].second->getLastReport());
+			}
+
+			// UTILIZATION, UNTIL THE MAKESPAN OR THE FAILURE
+			double busy = 0.0;
+			double capacity = 0.0;
+			for (size_t i = 0; i < members_.size(); i++)
+			{
+				std::shared_ptr<SystemReport> member = members_[i].second;
+
+				double span = (member->getFailedAt() >= 0.0) ? std::min<double>(member->getFailedAt(), makespan) : makespan;
+				double workers = (double)member->getWorkers();
+
+				if (span > 0.0 && workers > 0.0)
+					member->_Record_utilization(std::min<double>(member->getBusy() / (workers * span), 1.0));
+
+				busy += member->getBusy();
+				capacity += workers * span;
+
+				report->emplace_back(new SystemReport(*member));
+			}
+			report->_Set_makespan(makespan);
+			report->_Set_utilization((capacity > 0.0) ? std::min<double>(busy / capacity, 1.0) : 0.0);
+
+			return report;
+		};
+	};
+};
+};
+};
@@ -0,0 +1,230 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/Entity.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace simulation
+{
+	/**
+	 * Profile of a simulated system.
+	 *
+	 * The {@link SystemProfile} describes how a {@link SimulatedSystem} behaves in virtual time; speed of computation,
+	 * fixed overhead per a process, one-way latency of the network, jitter of the service time, number of workers and
+	 * scheduled faults (failure and slowdown).
+	 *
+	 * Service time of a process having *n* pieces is ```(overhead + n / speed) * slowdown * jitter```, where the
+	 * *jitter* follows a log-normal distribution whose median is 1.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class SystemProfile
+		: public protocol::Entity<>
+	{
+	private:
+		typedef protocol::Entity<> super;
+
+		std::string name_;
+		double speed_{ 1000.0 };
+		double overhead_{ 0.0 };
+		double latency_{ 0.001 };
+		double jitter_{ 0.0 };
+		size_t workers_{ 1 };
+
+		double fail_at_{ -1.0 };
+		double slowdown_at_{ -1.0 };
+		double slowdown_{ 1.0 };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor.
+		 */
+		SystemProfile() : super()
+		{
+		};
+
+		/**
+		 * Initializer Constructor.
+		 *
+		 * @param name Name of the system.
+		 * @param speed Pieces computed in a second, by a worker.
+		 * @param workers Number of workers, processes computed concurrently.
+		 */
+		SystemProfile(const std::string &name, double speed, size_t workers = 1)
+			: super()
+		{
+			name_ = name;
+			speed_ = speed;
+			workers_ = workers;
+		};
+		virtual ~SystemProfile() = default;
+
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			name_ = xml->getProperty<std::string>("name");
+			speed_ = xml->getProperty<double>("speed");
+			overhead_ = xml->getProperty<double>("overhead");
+			latency_ = xml->getProperty<double>("latency");
+			jitter_ = xml->getProperty<double>("jitter");
+			workers_ = xml->getProperty<size_t>("workers");
+
+			fail_at_ = xml->getProperty<double>("failAt");
+			slowdown_at_ = xml->getProperty<double>("slowdownAt");
+			slowdown_ = xml->getProperty<double>("slowdown");
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		virtual auto key() const -> std::string override
+		{
+			return name_;
+		};
+
+		auto getName() const -> std::string
+		{
+			return name_;
+		};
+		auto getSpeed() const -> double
+		{
+			return speed_;
+		};
+		auto getOverhead() const -> double
+		{
+			return overhead_;
+		};
+		auto getLatency() const -> double
+		{
+			return latency_;
+		};
+		auto getJitter() const -> double
+		{
+			return jitter_;
+		};
+		auto getWorkers() const -> size_t
+		{
+			return workers_;
+		};
+		auto getFailAt() const -> double
+		{
+			return fail_at_;
+		};
+		auto getSlowdownAt() const -> double
+		{
+			return slowdown_at_;
+		};
+		auto getSlowdown() const -> double
+		{
+			return slowdown_;
+		};
+
+		void setName(const std::string &val)
+		{
+			name_ = val;
+		};
+
+		/**
+		 * Set speed.
+		 *
+		 * @param val Pieces computed in a second, by a worker.
+		 */
+		void setSpeed(double val)
+		{
+			speed_ = val;
+		};
+
+		/**
+		 * Set overhead.
+		 *
+		 * @param val Fixed seconds spent on a process, regardless of its size.
+		 */
+		void setOverhead(double val)
+		{
+			overhead_ = val;
+		};
+
+		/**
+		 * Set latency.
+		 *
+		 * @param val One-way seconds of the network, between the master and the system.
+		 */
+		void setLatency(double val)
+		{
+			latency_ = val;
+		};
+
+		/**
+		 * Set jitter.
+		 *
+		 * @param val Sigma of the log-normal distribution multiplied to the service time. Zero means no jitter.
+		 */
+		void setJitter(double val)
+		{
+			jitter_ = val;
+		};
+
+		void setWorkers(size_t val)
+		{
+			workers_ = val;
+		};
+
+		/**
+		 * Schedule a failure.
+		 *
+		 * The system is disconnected at the time, with its processes on progress.
+		 *
+		 * @param at Seconds from start of the simulation. Negative value means no failure.
+		 */
+		void setFailAt(double at)
+		{
+			fail_at_ = at;
+		};
+
+		/**
+		 * Schedule a slowdown.
+		 *
+		 * Service times of the processes started after the time are multiplied by the *slowdown*.
+		 *
+		 * @param at Seconds from start of the simulation. Negative value means no slowdown.
+		 * @param slowdown Multiplier of the service time, larger than 1 to be slower.
+		 */
+		void setSlowdown(double at, double slowdown)
+		{
+			slowdown_at_ = at;
+			slowdown_ = slowdown;
+		};
+
+		/* ---------------------------------------------------------
+			EXPORTERS
+		--------------------------------------------------------- */
+		virtual auto TAG() const -> std::string override
+		{
+			return "profile";
+		};
+
+		virtual auto toXML() const -> std::shared_ptr<library::XML> override
+		{
+			std::shared_ptr<library::XML> xml = super::toXML();
+			xml->setProperty("name", name_);
+			xml->setProperty("speed", speed_);
+			xml->setProperty("overhead", overhead_);
+			xml->setProperty("latency", latency_);
+			xml->setProperty("jitter", jitter_);
+			xml->setProperty("workers", workers_);
+
+			xml->setProperty("failAt", fail_at_);
+			xml->setProperty("slowdownAt", slowdown_at_);
+			xml->setProperty("slowdown", slowdown_);
+
+			return xml;
+		};
+	};
+};
+};
+};
@@ -0,0 +1,242 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/Entity.hpp>
+
+#include <algorithm>
+
+namespace samchon
+{
+namespace templates
+{
+namespace simulation
+{
+	/**
+	 * Report of a simulated system.
+	 *
+	 * The {@link SystemReport} is a statistics of a {@link SimulatedSystem}, in a {@link SimulationReport}; number of
+	 * processes and pieces computed, number of processes cancelled, time that workers were busy, time of the last
+	 * report, time of failure and the performance index estimated by the master at the end.
+	 *
+	 * Times are seconds from start of the simulation.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class SystemReport
+		: public protocol::Entity<>
+	{
+	private:
+		typedef protocol::Entity<> super;
+
+		std::string name_;
+		size_t workers_{ 0 };
+
+		size_t processes_{ 0 };
+		size_t cancelled_{ 0 };
+		double pieces_{ 0.0 };
+		double busy_{ 0.0 };
+		double last_report_{ 0.0 };
+		double failed_at_{ -1.0 };
+
+		double performance_{ 1.0 };
+		double utilization_{ 0.0 };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor.
+		 */
+		SystemReport() : super()
+		{
+		};
+
+		/**
+		 * Initializer Constructor.
+		 *
+		 * @param name Name of the system.
+		 * @param workers Number of workers of the system.
+		 */
+		SystemReport(const std::string &name, size_t workers)
+			: super()
+		{
+			name_ = name;
+			workers_ = workers;
+		};
+		virtual ~SystemReport() = default;
+
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			name_ = xml->getProperty<std::string>("name");
+			workers_ = xml->getProperty<size_t>("workers");
+
+			processes_ = xml->getProperty<size_t>("processes");
+			cancelled_ = xml->getProperty<size_t>("cancelled");
+			pieces_ = xml->getProperty<double>("pieces");
+			busy_ = xml->getProperty<double>("busy");
+			last_report_ = xml->getProperty<double>("lastReport");
+			failed_at_ = xml->getProperty<double>("failedAt");
+
+			performance_ = xml->getProperty<double>("performance");
+			utilization_ = xml->getProperty<double>("utilization");
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		virtual auto key() const -> std::string override
+		{
+			return name_;
+		};
+
+		auto getName() const -> std::string
+		{
+			return name_;
+		};
+		auto getWorkers() const -> size_t
+		{
+			return workers_;
+		};
+
+		/**
+		 * Get number of processes computed.
+		 */
+		auto getProcesses() const -> size_t
+		{
+			return processes_;
+		};
+
+		/**
+		 * Get number of processes cancelled while running.
+		 */
+		auto getCancelled() const -> size_t
+		{
+			return cancelled_;
+		};
+
+		/**
+		 * Get number of pieces computed.
+		 */
+		auto getPieces() const -> double
+		{
+			return pieces_;
+		};
+
+		/**
+		 * Get sum of the service times, in seconds.
+		 */
+		auto getBusy() const -> double
+		{
+			return busy_;
+		};
+
+		/**
+		 * Get time of the last report, in seconds.
+		 */
+		auto getLastReport() const -> double
+		{
+			return last_report_;
+		};
+
+		/**
+		 * Get time of the failure, in seconds. Negative value means the system has not failed.
+		 */
+		auto getFailedAt() const -> double
+		{
+			return failed_at_;
+		};
+
+		/**
+		 * Get performance index estimated by the master.
+		 */
+		auto getPerformance() const -> double
+		{
+			return performance_;
+		};
+
+		/**
+		 * Get utilization of the workers, in [0, 1].
+		 */
+		auto getUtilization() const -> double
+		{
+			return utilization_;
+		};
+
+		/* ---------------------------------------------------------
+			RECORDERS
+		--------------------------------------------------------- */
+		/**
+		 * @hidden
+		 */
+		void _Record_process(double pieces, double busy, double at)
+		{
+			processes_++;
+			pieces_ += pieces;
+			busy_ += busy;
+			last_report_ = std::max<double>(last_report_, at);
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Record_cancellation(double busy)
+		{
+			cancelled_++;
+			busy_ += busy;
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Record_failure(double at)
+		{
+			failed_at_ = at;
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Record_performance(double val)
+		{
+			performance_ = val;
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Record_utilization(double val)
+		{
+			utilization_ = val;
+		};
+
+		/* ---------------------------------------------------------
+			EXPORTERS
+		--------------------------------------------------------- */
+		virtual auto TAG() const -> std::string override
+		{
+			return "system";
+		};
+
+		virtual auto toXML() const -> std::shared_ptr<library::XML> override
+		{
+			std::shared_ptr<library::XML> xml = super::toXML();
+			xml->setProperty("name", name_);
+			xml->setProperty("workers", workers_);
+
+			xml->setProperty("processes", processes_);
+			xml->setProperty("cancelled", cancelled_);
+			xml->setProperty("pieces", pieces_);
+			xml->setProperty("busy", busy_);
+			xml->setProperty("lastReport", last_report_);
+			xml->setProperty("failedAt", failed_at_);
+
+			xml->setProperty("performance", performance_);
+			xml->setProperty("utilization", utilization_);
+
+			return xml;
+		};
+	};
+};
+};
+};
@@ -0,0 +1,135 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <map>
+#include <chrono>
+#include <random>
+#include <functional>
+#include <mutex>
+
+namespace samchon
+{
+namespace templates
+{
+namespace simulation
+{
+	/**
+	 * A virtual clock driving a simulation.
+	 *
+	 * The {@link VirtualClock} is a discrete event queue. Events are {@link post posted} with delays in virtual time
+	 * and {@link step executed} one by one, in order of their times and then in order of posting. The clock jumps to
+	 * time of each event; waiting costs nothing. With a same seed of the {@link getEngine random engine}, a same
+	 * scenario is reproduced exactly.
+	 *
+	 * Events are executed by the caller of {@link step}, one at a time.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class VirtualClock
+	{
+	private:
+		std::chrono::system_clock::time_point now_;
+		std::multimap<std::chrono::system_clock::time_point, std::function<void()>> events_;
+		std::mt19937_64 engine_;
+
+		mutable std::mutex mtx_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from seed.
+		 *
+		 * @param seed Seed of the {@link getEngine random engine}.
+		 */
+		VirtualClock(unsigned int seed = 0)
+			: engine_(seed)
+		{
+			now_ = std::chrono::system_clock::time_point();
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get current virtual time.
+		 */
+		auto now() const -> std::chrono::system_clock::time_point
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return now_;
+		};
+
+		/**
+		 * Get number of events waiting.
+		 */
+		auto pending() const -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return events_.size();
+		};
+
+		/**
+		 * Get the random engine, for jitters of the simulation.
+		 */
+		auto getEngine() -> std::mt19937_64&
+		{
+			return engine_;
+		};
+
+		/* ---------------------------------------------------------
+			EVENTS
+		--------------------------------------------------------- */
+		/**
+		 * Post an event.
+		 *
+		 * @param delay Delay from now, in virtual time. Negative delay is regarded as zero.
+		 * @param event An event to execute.
+		 */
+		void post(std::chrono::system_clock::duration delay, std::function<void()> event)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			if (delay < std::chrono::system_clock::duration::zero())
+				delay = std::chrono::system_clock::duration::zero();
+
+			events_.emplace(now_ + delay, move(event));
+		};
+
+		/**
+		 * Execute the earliest event.
+		 *
+		 * @param until Limit of time. An event later than the limit is not executed.
+		 * @return Whether an event has been executed.
+		 */
+		auto step(std::chrono::system_clock::time_point until = std::chrono::system_clock::time_point::max()) -> bool
+		{
+			std::function<void()> event;
+			{
+				std::unique_lock<std::mutex> uk(mtx_);
+				if (events_.empty() == true || events_.begin()->first > until)
+					return false;
+
+				now_ = events_.begin()->first;
+				event = move(events_.begin()->second);
+				events_.erase(events_.begin());
+			}
+
+			event();
+			return true;
+		};
+
+		/**
+		 * Convert seconds to a duration of the virtual clock.
+		 *
+		 * @param seconds Seconds.
+		 */
+		static auto seconds(double seconds) -> std::chrono::system_clock::duration
+		{
+			return std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::duration<double>(seconds));
+		};
+	};
+};
+};
+};
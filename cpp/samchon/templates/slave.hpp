@@ -5,4 +5,10 @@
 #include <samchon/templates/slave/SlaveClient.hpp>
 
 #include <samchon/templates/slave/PInvoke.hpp>
-#include <samchon/templates/slave/InvokeHistory.hpp>
\ No newline at end of file
+#include <samchon/templates/slave/InvokeHistory.hpp>
+#include <samchon/templates/slave/BlobCache.hpp>
+#include <samchon/templates/slave/HistoryWindow.hpp>
+#include <samchon/templates/slave/CancellationToken.hpp>
+#include <samchon/templates/slave/WorkerPool.hpp>
+#include <samchon/templates/slave/Backlog.hpp>
+#include <samchon/templates/slave/CpuMeter.hpp>
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/Entity.hpp>
+
+#include <algorithm>
+
+namespace samchon
+{
+namespace templates
+{
+namespace slave
+{
+	/**
+	 * Backlog of a slave system.
+	 *
+	 * The {@link Backlog} is a snapshot of the {@link WorkerPool} in a {@link SlaveSystem}; number of workers, number
+	 * of tasks waiting in the queue, number of tasks running and utilization of the workers, with utilization of the
+	 * CPUs measured by a {@link CpuMeter}. The {@link Backlog} is piggybacked on reports of histories, so that the
+	 * master can know how much work is queued on the slave and how much the slave is disturbed by other processes.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class Backlog
+		: public protocol::Entity<>
+	{
+	private:
+		typedef protocol::Entity<> super;
+
+		size_t workers_{ 0 };
+		size_t pending_{ 0 };
+		size_t running_{ 0 };
+		double utilization_{ 0.0 };
+		double cpu_{ 0.0 };
+		double process_cpu_{ 0.0 };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor.
+		 */
+		Backlog() : super()
+		{
+		};
+
+		/**
+		 * Initializer Constructor.
+		 *
+		 * @param workers Number of workers.
+		 * @param pending Number of tasks waiting in the queue.
+		 * @param running Number of tasks running.
+		 * @param utilization Ratio of busy time of the workers, in [0, 1].
+		 * @param cpu Utilization of the CPUs of the host, in [0, 1].
+		 * @param processCpu Share of the slave process in the CPUs of the host, in [0, 1].
+		 */
+		Backlog(size_t workers, size_t pending, size_t running, double utilization, double cpu = 0.0, double processCpu = 0.0)
+			: super()
+		{
+			workers_ = workers;
+			pending_ = pending;
+			running_ = running;
+			utilization_ = utilization;
+			cpu_ = cpu;
+			process_cpu_ = processCpu;
+		};
+		virtual ~Backlog() = default;
+
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			workers_ = xml->getProperty<size_t>("workers");
+			pending_ = xml->getProperty<size_t>("pending");
+			running_ = xml->getProperty<size_t>("running");
+			utilization_ = xml->getProperty<double>("utilization");
+			cpu_ = xml->getProperty<double>("cpu");
+			process_cpu_ = xml->getProperty<double>("processCpu");
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		auto getWorkers() const -> size_t
+		{
+			return workers_;
+		};
+		auto getPending() const -> size_t
+		{
+			return pending_;
+		};
+		auto getRunning() const -> size_t
+		{
+			return running_;
+		};
+		auto getUtilization() const -> double
+		{
+			return utilization_;
+		};
+		auto getCpu() const -> double
+		{
+			return cpu_;
+		};
+		auto getProcessCpu() const -> double
+		{
+			return process_cpu_;
+		};
+
+		/**
+		 * Compute CPU consumed by other processes than the slave.
+		 *
+		 * @return Utilization of the host except share of the slave process, in [0, 1].
+		 */
+		auto computeForeignCpu() const -> double
+		{
+			return std::max<double>(cpu_ - process_cpu_, 0.0);
+		};
+
+		/* ---------------------------------------------------------
+			EXPORTERS
+		--------------------------------------------------------- */
+		virtual auto TAG() const -> std::string override
+		{
+			return "backlog";
+		};
+
+		virtual auto toXML() const -> std::shared_ptr<library::XML> override
+		{
+			std::shared_ptr<library::XML> xml = super::toXML();
+			xml->setProperty("workers", workers_);
+			xml->setProperty("pending", pending_);
+			xml->setProperty("running", running_);
+			xml->setProperty("utilization", utilization_);
+			xml->setProperty("cpu", cpu_);
+			xml->setProperty("processCpu", process_cpu_);
+
+			return xml;
+		};
+	};
+};
+};
+};
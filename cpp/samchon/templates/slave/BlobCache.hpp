@@ -0,0 +1,214 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/InvokeParameter.hpp>
+
+#include <list>
+#include <mutex>
+#include <samchon/HashMap.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace slave
+{
+	/**
+	 * A cache of binary blobs, in the slave side.
+	 *
+	 * The {@link BlobCache} keeps bodies of blobs delivered from the master's {@link external::BlobStore}, addressed
+	 * by hash of their contents. When total size of the bodies exceeds the {@link getCapacity capacity}, the least
+	 * recently used blobs are evicted. Evicted blobs are fetched from the master again when they're required.
+	 *
+	 * The bodies are stored as ```ByteArray``` typed {@link InvokeParameter} objects and shared with the
+	 * {@link Invoke} messages referencing them. Do not modify (or move) values of them.
+	 *
+	 * @see {@link SlaveSystem.getBlobCache}, {@link external::BlobStore}
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class BlobCache
+	{
+	private:
+		typedef std::list<std::pair<std::string, std::shared_ptr<protocol::InvokeParameter>>> list_type;
+
+		// FRONT IS THE MOST RECENTLY USED
+		list_type list_;
+		HashMap<std::string, list_type::iterator> dict_;
+
+		size_t capacity_;
+		size_t size_;
+
+		mutable std::mutex mtx_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from capacity.
+		 *
+		 * @param capacity Maximum total size of blobs in bytes. Default is 256 MB.
+		 */
+		BlobCache(size_t capacity = 256 * 1024 * 1024)
+		{
+			capacity_ = capacity;
+			size_ = 0;
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get capacity, maximum total size of blobs in bytes.
+		 */
+		auto getCapacity() const -> size_t
+		{
+			return capacity_;
+		};
+
+		/**
+		 * Set capacity.
+		 *
+		 * If total size of the blobs exceeds the new *capacity*, the least recently used blobs are evicted.
+		 *
+		 * @param capacity Maximum total size of blobs in bytes.
+		 */
+		void setCapacity(size_t capacity)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			capacity_ = capacity;
+			evict(0);
+		};
+
+		/**
+		 * Get total size of the blobs in bytes.
+		 */
+		auto size() const -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return size_;
+		};
+
+		/**
+		 * Get number of the blobs.
+		 */
+		auto count() const -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return list_.size();
+		};
+
+		/**
+		 * Test whether a blob is cached.
+		 *
+		 * @param key Hash of the blob.
+		 */
+		auto has(const std::string &key) const -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return dict_.has(key);
+		};
+
+		/**
+		 * Get a blob.
+		 *
+		 * The blob is marked as the most recently used.
+		 *
+		 * @param key Hash of the blob.
+		 * @return The body as a ```ByteArray``` typed parameter, or ```nullptr``` if not cached.
+		 */
+		auto get(const std::string &key) -> std::shared_ptr<protocol::InvokeParameter>
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = dict_.find(key);
+			if (it == dict_.end())
+				return nullptr;
+
+			list_.splice(list_.begin(), list_, it->second);
+			return it->second->second;
+		};
+
+		/* ---------------------------------------------------------
+			ELEMENTS I/O
+		--------------------------------------------------------- */
+		/**
+		 * Insert a blob.
+		 *
+		 * @param key Hash of the blob.
+		 * @param body The body as a ```ByteArray``` typed parameter.
+		 * @return Whether the blob is cached. A blob larger than the {@link getCapacity capacity} is not.
+		 */
+		auto insert(const std::string &key, std::shared_ptr<protocol::InvokeParameter> body) -> bool
+		{
+			size_t body_size = body->referValue<ByteArray>().size();
+
+			std::unique_lock<std::mutex> uk(mtx_);
+			if (body_size > capacity_)
+				return false;
+
+			// REPLACE THE OLD ONE
+			auto it = dict_.find(key);
+			if (it != dict_.end())
+			{
+				size_ -= it->second->second->referValue<ByteArray>().size();
+				list_.erase(it->second);
+				dict_.erase(it);
+			}
+
+			evict(body_size);
+
+			list_.emplace_front(key, body);
+			dict_.insert({ key, list_.begin() });
+			size_ += body_size;
+
+			return true;
+		};
+
+		/**
+		 * Erase a blob.
+		 *
+		 * @param key Hash of the blob.
+		 */
+		void erase(const std::string &key)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = dict_.find(key);
+			if (it == dict_.end())
+				return;
+
+			size_ -= it->second->second->referValue<ByteArray>().size();
+			list_.erase(it->second);
+			dict_.erase(it);
+		};
+
+		/**
+		 * Erase all blobs.
+		 */
+		void clear()
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			list_.clear();
+			dict_.clear();
+			size_ = 0;
+		};
+
+	private:
+		void evict(size_t reserved)
+		{
+			// ERASE THE LEAST RECENTLY USED ONES
+			while (list_.empty() == false && size_ + reserved > capacity_)
+			{
+				size_ -= list_.back().second->referValue<ByteArray>().size();
+
+				dict_.erase(list_.back().first);
+				list_.pop_back();
+			}
+		};
+	};
+};
+};
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <atomic>
+
+namespace samchon
+{
+namespace templates
+{
+namespace slave
+{
+	/**
+	 * A token notifying cancellation.
+	 *
+	 * The {@link CancellationToken} is shared between a {@link SlaveSystem} and a {@link PInvoke} being processed.
+	 * When the master cancels the process, the {@link SlaveSystem} {@link cancel cancels} the token. Then a handler
+	 * of long-running process (brute force search, genetic algorithm and so on), can stop early by polling
+	 * {@link isCancelled} periodically.
+	 *
+	 * The cancellation is cooperative; a handler ignoring the token runs to its end. However, the result of the
+	 * cancelled process is not reported to the master.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class CancellationToken
+	{
+	private:
+		std::atomic<bool> cancelled_{ false };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		CancellationToken()
+		{
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Test whether the process has been cancelled.
+		 */
+		auto isCancelled() const -> bool
+		{
+			return cancelled_.load();
+		};
+
+		/**
+		 * Cancel the process.
+		 */
+		void cancel()
+		{
+			cancelled_.store(true);
+		};
+	};
+};
+};
+};
@@ -0,0 +1,171 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <Windows.h>
+#else
+#	include <fstream>
+#	include <string>
+#	include <sys/resource.h>
+#endif
+
+namespace samchon
+{
+namespace templates
+{
+namespace slave
+{
+	/**
+	 * A meter of CPU utilization.
+	 *
+	 * The {@link CpuMeter} measures utilization of the CPUs of the host and share of this process in it, between two
+	 * calls of {@link measure}. Both are ratios to capacity of all the hardware threads. Their difference is the CPU
+	 * consumed by other processes, which slows down the workers of a {@link SlaveSystem} even if they're not busy.
+	 *
+	 * If the host's CPU times are not readable, the utilization of the host is regarded as same with the process.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class CpuMeter
+	{
+	private:
+		// PREVIOUS SAMPLES; BUSY AND TOTAL TIMES OF THE HOST AND CPU TIME OF THE PROCESS, IN SECONDS
+		double host_busy_;
+		double host_total_;
+		double process_;
+		std::chrono::steady_clock::time_point sampled_at_;
+
+		std::mutex mtx_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor, taking the first sample.
+		 */
+		CpuMeter()
+		{
+			sample_host(host_busy_, host_total_);
+			process_ = sample_process();
+			sampled_at_ = std::chrono::steady_clock::now();
+		};
+
+		/* ---------------------------------------------------------
+			MEASUREMENT
+		--------------------------------------------------------- */
+		/**
+		 * Measure utilization.
+		 *
+		 * @return Pair of utilization of the host and of this process, from the last measurement to now, in [0, 1].
+		 */
+		auto measure() -> std::pair<double, double>
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			double host_busy, host_total;
+			bool host = sample_host(host_busy, host_total);
+			double process = sample_process();
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+			// SHARE OF THE PROCESS IN ALL THE HARDWARE THREADS
+			double wall = std::chrono::duration<double>(now - sampled_at_).count()
+				* std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+			double mine = (wall > 0.0) ? clamp((process - process_) / wall) : 0.0;
+
+			// UTILIZATION OF THE HOST
+			double total = host_total - host_total_;
+			double all = (host == true && total > 0.0) ? clamp((host_busy - host_busy_) / total) : mine;
+
+			host_busy_ = host_busy;
+			host_total_ = host_total;
+			process_ = process;
+			sampled_at_ = now;
+
+			return std::make_pair(std::max<double>(all, mine), mine);
+		};
+
+	private:
+		static auto clamp(double val) -> double
+		{
+			return std::min<double>(std::max<double>(val, 0.0), 1.0);
+		};
+
+#ifdef _WIN32
+		static auto to_seconds(const FILETIME &time) -> double
+		{
+			ULARGE_INTEGER integer;
+			integer.LowPart = time.dwLowDateTime;
+			integer.HighPart = time.dwHighDateTime;
+
+			// 100 NANOSECONDS
+			return integer.QuadPart / 1e7;
+		};
+
+		static auto sample_host(double &busy, double &total) -> bool
+		{
+			FILETIME idle, kernel, user;
+			if (GetSystemTimes(&idle, &kernel, &user) == FALSE)
+			{
+				busy = total = 0.0;
+				return false;
+			}
+
+			// KERNEL TIME INCLUDES THE IDLE TIME
+			total = to_seconds(kernel) + to_seconds(user);
+			busy = total - to_seconds(idle);
+			return true;
+		};
+
+		static auto sample_process() -> double
+		{
+			FILETIME creation, exit, kernel, user;
+			if (GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user) == FALSE)
+				return 0.0;
+
+			return to_seconds(kernel) + to_seconds(user);
+		};
+#else
+		static auto sample_host(double &busy, double &total) -> bool
+		{
+			busy = total = 0.0;
+
+			// cpu USER NICE SYSTEM IDLE IOWAIT IRQ SOFTIRQ STEAL
+			std::ifstream stat("/proc/stat");
+			std::string label;
+			if (!(stat >> label) || label != "cpu")
+				return false;
+
+			double ticks;
+			for (size_t i = 0; i < 8 && (stat >> ticks); i++)
+			{
+				total += ticks;
+				if (i != 3 && i != 4)
+					busy += ticks;
+			}
+			return total > 0.0;
+		};
+
+		static auto sample_process() -> double
+		{
+			rusage usage;
+			if (getrusage(RUSAGE_SELF, &usage) != 0)
+				return 0.0;
+
+			return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6
+				+ usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+		};
+#endif
+	};
+};
+};
+};
@@ -0,0 +1,238 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/slave/InvokeHistory.hpp>
+
+#include <deque>
+#include <chrono>
+#include <algorithm>
+#include <samchon/HashMap.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace slave
+{
+	/**
+	 * A bounded window of histories.
+	 *
+	 * The {@link HistoryWindow} keeps only the recent {@link InvokeHistory} objects, bounded by count and, optionally,
+	 * by age. When a new history comes and the window is full, the oldest ones are evicted. Thus, memory is bounded
+	 * regardless of uptime. Age is measured from the current time given by the owner, such as 
+	 * {@link ParallelSystemArray._Now}, so that a virtual clock of a {@link simulation::Simulator} also works.
+	 *
+	 * A history can be inserted with a *sample*, a numeric value representing the history like elapsed time.
+	 * Statistics of the samples, {@link mean} in the window and {@link ewma exponentially weighted moving average},
+	 * are maintained incrementally. Insertion, eviction and the statistics cost constant time.
+	 *
+	 * @tparam History Type of the histories.
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	template <class History = InvokeHistory>
+	class HistoryWindow
+	{
+	private:
+		struct Element
+		{
+			std::shared_ptr<History> history;
+			double sample;
+			bool sampled;
+		};
+
+		std::deque<Element> queue_;
+		HashMap<size_t, std::shared_ptr<History>> dict_;
+
+		size_t capacity_;
+		std::chrono::system_clock::duration max_age_;
+
+		// STATISTICS
+		double sum_;
+		size_t sampled_count_;
+		double ewma_;
+		double alpha_;
+		bool ewma_ready_;
+		size_t count_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from bounds.
+		 *
+		 * @param capacity Maximum number of histories in the window.
+		 * @param maxAge Maximum age of histories, from their end time. Zero means unlimited.
+		 * @param alpha Smoothing factor of the {@link ewma}, in (0, 1].
+		 */
+		HistoryWindow(size_t capacity = 1024, std::chrono::system_clock::duration maxAge = std::chrono::system_clock::duration::zero(), double alpha = .1)
+		{
+			capacity_ = std::max<size_t>(capacity, 1);
+			max_age_ = maxAge;
+			alpha_ = std::min<double>(std::max<double>(alpha, .001), 1.0);
+
+			sum_ = 0.0;
+			sampled_count_ = 0;
+			ewma_ = 0.0;
+			ewma_ready_ = false;
+			count_ = 0;
+		};
+
+		/**
+		 * Change bounds.
+		 *
+		 * @param capacity Maximum number of histories in the window.
+		 * @param maxAge Maximum age of histories, from their end time. Zero means unlimited.
+		 * @param now Current time, to evict expired histories. Default is now of the system clock.
+		 */
+		void reserve(size_t capacity, std::chrono::system_clock::duration maxAge = std::chrono::system_clock::duration::zero(), std::chrono::system_clock::time_point now = std::chrono::system_clock::now())
+		{
+			capacity_ = std::max<size_t>(capacity, 1);
+			max_age_ = maxAge;
+
+			evict(now);
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get number of histories in the window.
+		 */
+		auto size() const -> size_t
+		{
+			return queue_.size();
+		};
+		auto empty() const -> bool
+		{
+			return queue_.empty();
+		};
+
+		/**
+		 * Get number of all the histories have inserted, including the evicted ones.
+		 */
+		auto count() const -> size_t
+		{
+			return count_;
+		};
+
+		auto has(size_t uid) const -> bool
+		{
+			return dict_.has(uid);
+		};
+		auto get(size_t uid) const -> std::shared_ptr<History>
+		{
+			return dict_.get(uid);
+		};
+
+		/**
+		 * Get mean of the samples in the window.
+		 *
+		 * @return The mean, ```-1``` if there's no sample.
+		 */
+		auto mean() const -> double
+		{
+			if (sampled_count_ == 0)
+				return -1;
+			else
+				return sum_ / sampled_count_;
+		};
+
+		/**
+		 * Get exponentially weighted moving average of the samples.
+		 *
+		 * Unlike the {@link mean}, the EWMA reflects the evicted samples, with exponentially decayed weights.
+		 *
+		 * @return The EWMA, ```-1``` if there's no sample.
+		 */
+		auto ewma() const -> double
+		{
+			if (ewma_ready_ == false)
+				return -1;
+			else
+				return ewma_;
+		};
+
+		/* ---------------------------------------------------------
+			ELEMENTS I/O
+		--------------------------------------------------------- */
+		/**
+		 * Insert a history without sample.
+		 *
+		 * @param uid Unique identifier of the history.
+		 * @param history The history to insert.
+		 * @param now Current time, to evict expired histories. Default is now of the system clock.
+		 */
+		void insert(size_t uid, std::shared_ptr<History> history, std::chrono::system_clock::time_point now = std::chrono::system_clock::now())
+		{
+			push(uid, { history, 0.0, false }, now);
+		};
+
+		/**
+		 * Insert a history with sample.
+		 *
+		 * @param uid Unique identifier of the history.
+		 * @param history The history to insert.
+		 * @param sample A value representing the history, for the statistics.
+		 * @param now Current time, to evict expired histories. Default is now of the system clock.
+		 */
+		void insert(size_t uid, std::shared_ptr<History> history, double sample, std::chrono::system_clock::time_point now = std::chrono::system_clock::now())
+		{
+			if (dict_.has(uid) == true)
+				return;
+
+			ewma_ = ewma_ready_ ? alpha_ * sample + (1 - alpha_) * ewma_ : sample;
+			ewma_ready_ = true;
+
+			push(uid, { history, sample, true }, now);
+		};
+
+	private:
+		void push(size_t uid, Element &&elem, std::chrono::system_clock::time_point now)
+		{
+			if (dict_.has(uid) == true)
+				return; // DUPLICATED
+
+			if (elem.sampled == true)
+			{
+				sum_ += elem.sample;
+				sampled_count_++;
+			}
+			dict_.insert({ uid, elem.history });
+			queue_.push_back(std::move(elem));
+			count_++;
+
+			evict(now);
+		};
+
+		void evict(std::chrono::system_clock::time_point now)
+		{
+			while (queue_.empty() == false)
+			{
+				Element &front = queue_.front();
+
+				bool full = queue_.size() > capacity_;
+				bool expired = max_age_ != std::chrono::system_clock::duration::zero()
+					&& now - front.history->getEndTime() > max_age_;
+
+				if (full == false && expired == false)
+					break;
+
+				// EVICT THE OLDEST
+				if (front.sampled == true)
+				{
+					sum_ -= front.sample;
+					sampled_count_--;
+				}
+				dict_.erase(front.history->getUID());
+				queue_.pop_front();
+			}
+
+			// PREVENT ACCUMULATED ERROR
+			if (sampled_count_ == 0)
+				sum_ = 0.0;
+		};
+	};
+};
+};
+};
@@ -6,6 +6,8 @@
 #include <samchon/library/Date.hpp>
 #include <samchon/protocol/Invoke.hpp>
 
+#include <chrono>
+
 namespace samchon
 {
 namespace templates
@@ -23,6 +25,10 @@ namespace slave
 	 * - {@link ParallelSytem.getPerformance}
 	 * - {@link DistributedProcess.getResource}
 	 * 
+	 * {@link getStartTime Start} and {@link getEndTime end time} are stamped by the system clock of the **slave**, 
+	 * which may be skewed from the **master**'s and may jump. Thus the {@link computeElapsedTime elapsed time} is 
+	 * measured by the steady clock of the **slave**, as a duration, and reported with them.
+	 * 
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	class InvokeHistory 
@@ -38,6 +44,13 @@ namespace slave
 		library::Date start_time_;
 		library::Date end_time_;
 
+		// MEASURED BY THE STEADY CLOCK; NEGATIVE MEANS UNKNOWN
+		std::chrono::steady_clock::time_point steady_start_;
+		std::chrono::nanoseconds elapsed_{ -1 };
+
+		// UNIT OF THE TIMES ON THE WIRE; 100 NANOSECONDS
+		typedef std::chrono::duration<long long, std::ratio<1, 10000000>> Ticks;
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -61,6 +74,7 @@ namespace slave
 			listener_ = invoke->getListener();
 
 			start_time_ = std::chrono::system_clock::now();
+			steady_start_ = std::chrono::steady_clock::now();
 		};
 
 		virtual ~InvokeHistory() = default;
@@ -79,8 +93,11 @@ namespace slave
 			end_time_ = std::chrono::system_clock::from_time_t(0);
 
 			// ADD NUMBERS WHO REPRESENT LINUX_TIME
-			start_time_ += std::chrono::duration<long long, std::ratio_multiply<std::ratio<100i64, 1i64>, std::nano>>(xml->getProperty<long long>("startTime"));
-			end_time_ += std::chrono::duration<long long, std::ratio_multiply<std::ratio<100i64, 1i64>, std::nano>>(xml->getProperty<long long>("endTime"));
+			start_time_ += std::chrono::duration_cast<std::chrono::system_clock::duration>(Ticks(xml->getProperty<long long>("startTime")));
+			end_time_ += std::chrono::duration_cast<std::chrono::system_clock::duration>(Ticks(xml->getProperty<long long>("endTime")));
+
+			// ELAPSED TIME BY THE STEADY CLOCK, IF REPORTED
+			elapsed_ = std::chrono::nanoseconds(xml->hasProperty("elapsed") ? xml->getProperty<long long>("elapsed") : -1);
 		};
 
 		/* ---------------------------------------------------------
@@ -128,21 +145,38 @@ namespace slave
 		/**
 		 * Compute elapsed time.
 		 * 
+		 * The elapsed time measured by the steady clock of the **slave**. If it's not measured, like a history 
+		 * constructed by the **master** or by an old **slave**, difference between the {@link getEndTime end} and 
+		 * {@link getStartTime start time} is returned.
+		 * 
 		 * @return nanoseconds.
 		 */
 		auto computeElapsedTime() const -> long long
 		{
-			return (end_time_ - start_time_).count();
+			if (elapsed_.count() >= 0)
+				return elapsed_.count();
+			else
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(end_time_ - start_time_).count();
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Set_elapsed_time(std::chrono::nanoseconds val)
+		{
+			elapsed_ = val;
 		};
 
 		/**
 		 * Complete the history.
 		 * 
-		 * Completes the history and determines the {@link getEndTime end time}.
+		 * Completes the history and determines the {@link getEndTime end time} and the 
+		 * {@link computeElapsedTime elapsed time}.
 		 */
 		void complete()
 		{
 			end_time_ = std::chrono::system_clock::now();
+			elapsed_ = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - steady_start_);
 		};
 
 		/* ---------------------------------------------------------
@@ -159,8 +193,10 @@ namespace slave
 			xml->setProperty("uid", uid_);
 			xml->setProperty("listener", listener_);
 
-			xml->setProperty("startTime", start_time_.time_since_epoch().count());
-			xml->setProperty("endTime", end_time_.time_since_epoch().count());
+			xml->setProperty("startTime", std::chrono::duration_cast<Ticks>(start_time_.time_since_epoch()).count());
+			xml->setProperty("endTime", std::chrono::duration_cast<Ticks>(end_time_.time_since_epoch()).count());
+			if (elapsed_.count() >= 0)
+				xml->setProperty("elapsed", elapsed_.count());
 
 			return xml;
 		};
@@ -4,8 +4,13 @@
 #include <samchon/protocol/Invoke.hpp>
 
 #include <samchon/templates/slave/InvokeHistory.hpp>
+#include <samchon/templates/slave/CancellationToken.hpp>
+#include <samchon/templates/tracing/SpanArray.hpp>
 #include <samchon/protocol/IProtocol.hpp>
 
+#include <chrono>
+#include <functional>
+
 namespace samchon
 {
 namespace templates
@@ -19,6 +24,10 @@ namespace slave
 
 		std::shared_ptr<InvokeHistory> history_;
 		protocol::IProtocol *master_driver_;
+		std::shared_ptr<CancellationToken> token_;
+		std::shared_ptr<protocol::InvokeParameter> result_;
+		std::shared_ptr<tracing::SpanArray> trace_;
+		std::function<std::chrono::system_clock::time_point()> clock_;
 
 		bool hold_;
 
@@ -32,8 +41,10 @@ namespace slave
 		 * @param invoke The {@link Invoke} message came from the master.
 		 * @param history A {@link InvokeHistory history} object archiving the process command.
 		 * @param masterDriver 
+		 * @param token A {@link CancellationToken token} notifying cancellation from the master.
+		 * @param trace {@link SpanArray Spans} to be reported, if the master traces the process.
 		 */
-		PInvoke(const std::shared_ptr<protocol::Invoke> &invoke, std::shared_ptr<InvokeHistory> history, protocol::IProtocol *masterDriver)
+		PInvoke(const std::shared_ptr<protocol::Invoke> &invoke, std::shared_ptr<InvokeHistory> history, protocol::IProtocol *masterDriver, std::shared_ptr<CancellationToken> token = nullptr, std::shared_ptr<tracing::SpanArray> trace = nullptr)
 			: super(invoke->getListener()) // COPY LISTENER
 		{
 			// ASSIGN PARAMETERS
@@ -42,6 +53,9 @@ namespace slave
 			// MEMBERS
 			this->history_ = history;
 			this->master_driver_ = masterDriver;
+			this->token_ = (token == nullptr) ? std::make_shared<CancellationToken>() : token;
+			this->trace_ = trace;
+			this->clock_ = []() { return std::chrono::system_clock::now(); };
 
 			// DEFAULT IS NOT BEING HOLD
 			this->hold_ = false;
@@ -54,9 +68,41 @@ namespace slave
 
 		void complete()
 		{
+			// THE MASTER HAS DROPPED THE CANCELLED PROCESS
+			if (token_->isCancelled() == true)
+				return;
+
 			history_->complete();
 
-			master_driver_->sendData(history_->toInvoke());
+			// REPORT WITH THE PARTIAL RESULT, TO BE REDUCED BY THE MASTER
+			std::shared_ptr<protocol::Invoke> invoke = history_->toInvoke();
+			if (result_ != nullptr)
+				invoke->push_back(result_);
+
+			// SPAN OF THE HANDLER, WITH TIME OF SENDING THE REPORT
+			if (trace_ != nullptr)
+			{
+				trace_->emplace_back(new tracing::Span("handler", "", history_->getUID(), history_->getStartTime(), history_->getEndTime()));
+				trace_->setSent(clock_());
+
+				invoke->emplace_back(new protocol::InvokeParameter("_Trace", trace_->toXML()));
+			}
+
+			master_driver_->sendData(invoke);
+		};
+
+		/**
+		 * Set partial result.
+		 *
+		 * Sets result of the piece, to be merged by the master's {@link Reducer}, when the process is requested by 
+		 * {@link ParallelSystemArray.reducePieceData}. The result is reported with completion of the process.
+		 *
+		 * @param val The partial result, a value supported by the {@link InvokeParameter}.
+		 */
+		template <typename T>
+		void setResult(const T &val)
+		{
+			result_.reset(new protocol::InvokeParameter("result", val));
 		};
 
 		/* ---------------------------------------------------------
@@ -70,6 +116,33 @@ namespace slave
 		{
 			return hold_;
 		};
+		auto getResult() const -> std::shared_ptr<protocol::InvokeParameter>
+		{
+			return result_;
+		};
+
+		/**
+		 * Get cancellation token.
+		 *
+		 * A handler of long-running process can poll the {@link CancellationToken token} to stop early, when the 
+		 * master cancels the process. Result of the cancelled process is not reported.
+		 */
+		auto getCancellationToken() const -> std::shared_ptr<CancellationToken>
+		{
+			return token_;
+		};
+		auto isCancelled() const -> bool
+		{
+			return token_->isCancelled();
+		};
+
+		/**
+		 * @hidden
+		 */
+		void _Set_clock(std::function<std::chrono::system_clock::time_point()> clock)
+		{
+			clock_ = move(clock);
+		};
 	};
 };
 };
@@ -5,6 +5,17 @@
 
 #include <samchon/protocol/Communicator.hpp>
 #include <samchon/templates/slave/PInvoke.hpp>
+#include <samchon/templates/slave/BlobCache.hpp>
+#include <samchon/templates/slave/WorkerPool.hpp>
+#include <samchon/templates/slave/CpuMeter.hpp>
+#include <samchon/templates/parallel/PRInvokeHistory.hpp>
+#include <samchon/templates/tracing/SpanArray.hpp>
+
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <samchon/HashMap.hpp>
 
 namespace samchon
 {
@@ -18,6 +29,19 @@ namespace slave
 	protected:
 		std::shared_ptr<protocol::Communicator> communicator_;
 
+	private:
+		BlobCache blob_cache_;
+		HashMap<std::string, std::vector<std::shared_ptr<protocol::Invoke>>> blob_waits_;
+		std::mutex blob_mtx_;
+
+		// TOKENS OF THE PROCESSES ON PROGRESS; UID -> (FIRST INDEX OF PIECE, TOKEN)
+		// (UID, FIRST INDEX OF PIECE) -> TOKEN, ERASED WHEN THE PROCESS IS REPORTED OR CANCELLED
+		std::multimap<std::pair<size_t, size_t>, std::weak_ptr<CancellationToken>> token_map_;
+		std::mutex token_mtx_;
+
+		WorkerPool worker_pool_;
+		CpuMeter cpu_meter_;
+
 	public:
 		/* ---------------------------------------------------------
 			CONSTRUCTORS
@@ -25,41 +49,368 @@ namespace slave
 		SlaveSystem()
 		{
 		};
-		virtual ~SlaveSystem() = default;
+		virtual ~SlaveSystem()
+		{
+			worker_pool_.stop();
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get the {@link BlobCache}, blobs delivered from the master.
+		 */
+		auto getBlobCache() -> BlobCache&
+		{
+			return blob_cache_;
+		};
+
+		/**
+		 * Get the {@link WorkerPool}, executing the processes requested by the master.
+		 *
+		 * Configure number of workers, capacity of the queue and priorities of processes through it.
+		 */
+		auto getWorkerPool() -> WorkerPool&
+		{
+			return worker_pool_;
+		};
 
 		/* ---------------------------------------------------------
 			INVOKE MESSAGE CHAIN
 		--------------------------------------------------------- */
 		void sendData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
+			// PIGGYBACK THE BACKLOG ON REPORTS
+			if ((invoke->getListener() == "_Report_history" || invoke->getListener() == "_Report_histories") 
+				&& invoke->has("_Backlog") == false)
+				invoke->emplace_back(new protocol::InvokeParameter("_Backlog", _Get_backlog().toXML()));
+
+			// THE PROCESS HAS FINISHED
+			if (invoke->getListener() == "_Report_history")
+				_Unregister_token(invoke->front()->getValueAsXML());
+
 			communicator_->sendData(invoke);
 		};
 		
 	protected:
+		/**
+		 * Get backlog, to be reported to the master.
+		 *
+		 * The master folds the backlog into allocation of pieces and selection of systems.
+		 */
+		virtual auto _Get_backlog() -> Backlog
+		{
+			Backlog backlog = worker_pool_.getBacklog();
+			std::pair<double, double> cpu = cpu_meter_.measure();
+
+			return Backlog
+			(
+				backlog.getWorkers(), backlog.getPending(), backlog.getRunning(), backlog.getUtilization(), 
+				cpu.first, cpu.second
+			);
+		};
+
+		/**
+		 * Get current time.
+		 *
+		 * Times of the spans and the ```_Pong``` are taken from it. Default is the system clock. A 
+		 * {@link MediatorSystem} follows clock of its {@link ParallelSystemArrayMediator}.
+		 */
+		virtual auto _Now() const -> std::chrono::system_clock::time_point
+		{
+			return std::chrono::system_clock::now();
+		};
+
+		/**
+		 * Reply a ```_Pong``` to a ```_Ping``` of the master, at once.
+		 *
+		 * The ```_Pong``` carries sequence number of the ping, time it was received in microseconds since epoch of 
+		 * the system clock, and nanoseconds it was held measured by the steady clock. The master estimates offset of 
+		 * the clocks and round trip time with them.
+		 *
+		 * @param invoke The ```_Ping``` message.
+		 */
+		void _Reply_ping(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			std::chrono::system_clock::time_point received = _Now();
+			std::chrono::steady_clock::time_point holding = std::chrono::steady_clock::now();
+
+			std::shared_ptr<protocol::Invoke> pong(new protocol::Invoke("_Pong"));
+			pong->emplace_back(new protocol::InvokeParameter("seq", invoke->front()->getValue<size_t>()));
+			pong->emplace_back(new protocol::InvokeParameter("received", (long long)std::chrono::duration_cast<std::chrono::microseconds>(received.time_since_epoch()).count()));
+			pong->emplace_back(new protocol::InvokeParameter("held", (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - holding).count()));
+
+			sendData(pong);
+		};
+
 		virtual void _Reply_data(std::shared_ptr<protocol::Invoke> invoke) override
 		{
+			if (invoke->getListener() == "_Cancel_history")
+			{
+				_Cancel_history(invoke);
+				return;
+			}
+			else if (invoke->getListener() == "_Ping")
+			{
+				_Reply_ping(invoke);
+				return;
+			}
+			else if (_Handle_blobs(invoke) == true)
+				return;
+
 			if (invoke->has("_History_uid"))
 			{
-				std::thread([this, invoke]()
+				// REGISTER TOKEN BEFORE THE PROCESS, NOT TO MISS A CANCELLATION
+				std::shared_ptr<CancellationToken> token = _Register_token(invoke);
+
+				// SPANS REQUESTED BY THE MASTER, FROM NOW
+				std::chrono::system_clock::time_point received = _Now();
+				std::shared_ptr<tracing::SpanArray> trace;
+
+				if (invoke->has("_Trace") == true)
+				{
+					trace.reset(new tracing::SpanArray());
+					trace->setReceived(received);
+				}
+
+				// PRIORITY BY NAME OF THE PROCESS
+				std::string name = invoke->has("_Process_name") 
+					? invoke->get("_Process_name")->getValue<std::string>() 
+					: invoke->getListener();
+
+				worker_pool_.post(name, [this, invoke, token, trace, received]()
 				{
-					// INIT HISTORY - WITH START TIME
-					std::shared_ptr<InvokeHistory> history(new InvokeHistory(invoke));
+					if (token->isCancelled() == true)
+						return;
+
+					// INIT HISTORY - WITH START TIME (AND RANGE OF PIECES, TO BE IDENTIFIED BY THE MASTER)
+					std::shared_ptr<InvokeHistory> history;
+					if (invoke->has("_Piece_first") == true)
+						history.reset(new parallel::PRInvokeHistory(invoke));
+					else
+						history.reset(new InvokeHistory(invoke));
 					invoke->erase("_History_uid");
 					invoke->erase("_Process_name");
 					invoke->erase("_Process_weight");
+					invoke->erase("_Reducer");
+					invoke->erase("_Trace");
+
+					if (trace != nullptr)
+						trace->emplace_back(new tracing::Span("queue", "", history->getUID(), received, history->getStartTime()));
 
 					// MAIN PROCESS - REPLY_DATA
-					std::shared_ptr<PInvoke> pInvoke(new PInvoke(invoke, history, this));
+					std::shared_ptr<PInvoke> pInvoke(new PInvoke(invoke, history, this, token, trace));
+					pInvoke->_Set_clock([this]() { return _Now(); });
 					replyData(pInvoke);
 
 					// NOTIFY - WITH END TIME
 					if (pInvoke->isHold() == false)
 						pInvoke->complete();
-				}).detach();
+				});
 			}
 			else
 				replyData(invoke);
 		};
+
+		/**
+		 * Handle blobs.
+		 *
+		 * Replaces ```Blob``` parameters of the *invoke* with their bodies in the {@link BlobCache}. If some bodies are
+		 * not cached, the *invoke* waits for them, which are fetched from the master.
+		 *
+		 * @param invoke An {@link Invoke} message received from the master.
+		 * @return Whether the *invoke* is consumed; a delivery of blob or a message waiting for blobs.
+		 */
+		auto _Handle_blobs(std::shared_ptr<protocol::Invoke> invoke) -> bool
+		{
+			if (invoke->getListener() == "_Store_blob")
+			{
+				_Store_blob(invoke);
+				return true;
+			}
+
+			// REPLACE THE CACHED ONES
+			std::vector<std::string> missed;
+			for (size_t i = 0; i < invoke->size(); i++)
+			{
+				if (invoke->at(i)->getType() != "Blob")
+					continue;
+
+				std::string key = invoke->at(i)->referValue<std::string>();
+				std::shared_ptr<protocol::InvokeParameter> body = blob_cache_.get(key);
+
+				if (body == nullptr)
+					missed.push_back(key);
+				else
+					replace_blob(invoke, key, body);
+			}
+			if (missed.empty() == true)
+				return false;
+
+			// WAIT FOR THE MISSED ONES
+			std::vector<std::string> fetches;
+			{
+				std::unique_lock<std::mutex> uk(blob_mtx_);
+				for (size_t i = 0; i < missed.size(); i++)
+					if (blob_waits_.has(missed[i]) == false)
+					{
+						blob_waits_[missed[i]];
+						fetches.push_back(missed[i]);
+					}
+				blob_waits_[missed.front()].push_back(invoke);
+			}
+
+			// FETCH THEM FROM THE MASTER
+			for (size_t i = 0; i < fetches.size(); i++)
+				sendData(std::make_shared<protocol::Invoke>("_Fetch_blob", fetches[i]));
+
+			return true;
+		};
+
+		/**
+		 * Register a cancellation token.
+		 *
+		 * @param invoke An {@link Invoke} message requesting a process, having ```_History_uid```.
+		 * @return A {@link CancellationToken token} of the process.
+		 */
+		auto _Register_token(std::shared_ptr<protocol::Invoke> invoke) -> std::shared_ptr<CancellationToken>
+		{
+			std::shared_ptr<CancellationToken> token(new CancellationToken());
+
+			size_t uid = invoke->get("_History_uid")->getValue<size_t>();
+			size_t first = invoke->has("_Piece_first") ? invoke->get("_Piece_first")->getValue<size_t>() : (size_t)-1;
+
+			std::unique_lock<std::mutex> uk(token_mtx_);
+			token_map_.emplace(std::make_pair(uid, first), token);
+
+			return token;
+		};
+
+		/**
+		 * Unregister a cancellation token, of a process reported.
+		 *
+		 * @param xml An {@link XML} object represents history of the process.
+		 */
+		void _Unregister_token(std::shared_ptr<library::XML> xml)
+		{
+			if (xml == nullptr || xml->hasProperty("uid") == false)
+				return;
+
+			size_t uid = xml->getProperty<size_t>("uid");
+			size_t first = xml->hasProperty("first") ? xml->getProperty<size_t>("first") : (size_t)-1;
+
+			std::unique_lock<std::mutex> uk(token_mtx_);
+
+			auto it = token_map_.find(std::make_pair(uid, first));
+			if (it != token_map_.end())
+				token_map_.erase(it);
+		};
+
+		/**
+		 * Cancel processes.
+		 *
+		 * Cancels {@link CancellationToken tokens} of the processes matched with the ```_Cancel_history``` message; 
+		 * all the processes having the UID or only a piece starting from the index, if specified.
+		 *
+		 * @param invoke A ```_Cancel_history``` message, with UID and optional first index of piece.
+		 */
+		void _Cancel_history(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			size_t uid = invoke->front()->getValue<size_t>();
+			size_t first = (invoke->size() > 1) ? invoke->at(1)->getValue<size_t>() : (size_t)-1;
+
+			std::unique_lock<std::mutex> uk(token_mtx_);
+
+			// ALL THE PIECES HAVING THE UID, OR THE PIECE ONLY
+			auto begin = token_map_.lower_bound(std::make_pair(uid, (first == (size_t)-1) ? 0 : first));
+			auto end = token_map_.upper_bound(std::make_pair(uid, first));
+
+			for (auto it = begin; it != end; it++)
+			{
+				std::shared_ptr<CancellationToken> token = it->second.lock();
+				if (token != nullptr)
+					token->cancel();
+			}
+			token_map_.erase(begin, end);
+		};
+
+	private:
+		void _Store_blob(std::shared_ptr<protocol::Invoke> invoke)
+		{
+			const std::string &key = invoke->front()->referValue<std::string>();
+			std::shared_ptr<protocol::InvokeParameter> body;
+
+			if (invoke->has("data") == true)
+			{
+				body = invoke->get("data");
+				blob_cache_.insert(key, body);
+			}
+
+			// RESUME MESSAGES WAITING FOR THE BLOB
+			std::vector<std::shared_ptr<protocol::Invoke>> waits;
+			{
+				std::unique_lock<std::mutex> uk(blob_mtx_);
+
+				auto it = blob_waits_.find(key);
+				if (it == blob_waits_.end())
+					return;
+
+				waits = move(it->second);
+				blob_waits_.erase(it);
+			}
+
+			for (size_t i = 0; i < waits.size(); i++)
+				if (body == nullptr)
+					_Fail_blob(waits[i], key); // THE MASTER HAS ERASED THE BLOB
+				else
+				{
+					replace_blob(waits[i], key, body);
+					_Reply_data(waits[i]);
+				}
+		};
+
+		/**
+		 * Fail a message waiting for a blob the master has erased.
+		 *
+		 * The handler is not called. A process is reported back at once with an ```_Error```, which rejects its 
+		 * reduction in the master. Other messages are dropped.
+		 */
+		void _Fail_blob(std::shared_ptr<protocol::Invoke> invoke, const std::string &key)
+		{
+			if (invoke->has("_History_uid") == false)
+				return;
+
+			std::shared_ptr<InvokeHistory> history;
+			if (invoke->has("_Piece_first") == true)
+				history.reset(new parallel::PRInvokeHistory(invoke));
+			else
+				history.reset(new InvokeHistory(invoke));
+			history->complete();
+
+			std::shared_ptr<protocol::Invoke> report = history->toInvoke();
+			report->emplace_back(new protocol::InvokeParameter("_Error", "The blob " + key + " has been erased by the master."));
+
+			sendData(report);
+		};
+
+		static void replace_blob(std::shared_ptr<protocol::Invoke> invoke, const std::string &key, std::shared_ptr<protocol::InvokeParameter> body)
+		{
+			for (size_t i = 0; i < invoke->size(); i++)
+			{
+				std::shared_ptr<protocol::InvokeParameter> &parameter = invoke->at(i);
+				if (parameter->getType() != "Blob" || parameter->referValue<std::string>() != key)
+					continue;
+
+				if (parameter->getName() == body->getName())
+					parameter = body; // SHARE, WITHOUT COPY
+				else // RENAMED, REFERENCING THE BODY WITHOUT COPY
+					parameter.reset(new protocol::InvokeParameter
+					(
+						parameter->getName(), 
+						std::shared_ptr<const ByteArray>(body, &body->referValue<ByteArray>())
+					));
+			}
+		};
 	};
 };
 };
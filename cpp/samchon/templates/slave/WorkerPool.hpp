@@ -0,0 +1,306 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/slave/Backlog.hpp>
+#include <samchon/library/ThreadPool.hpp>
+
+#include <map>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <functional>
+#include <mutex>
+#include <samchon/HashMap.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace slave
+{
+	/**
+	 * A bounded pool of workers.
+	 *
+	 * The {@link WorkerPool} executes processes requested to a {@link SlaveSystem} by a fixed number of workers,
+	 * sized to the hardware by default, instead of creating a thread for each process. Thus, a burst of pieces does
+	 * not oversubscribe the cores. The workers are threads of a {@link library::ThreadPool}; the {@link WorkerPool}
+	 * only orders the tasks.
+	 *
+	 * Tasks are executed in order of {@link setPriority priority} of their process names and then in order of
+	 * posting. Number of waiting and running tasks and utilization of the workers are reported to the master with
+	 * a {@link Backlog}, so that the master sends fewer pieces to a busy slave.
+	 *
+	 * The {@link capacity} of the queue is a soft bound. {@link post} never blocks, because it is called by the 
+	 * thread reading messages from the master, and blocking it would also hold cancellations, pings and blobs. Tasks 
+	 * over the {@link capacity} are kept in the queue and the pool is {@link isSaturated saturated}.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class WorkerPool
+	{
+	private:
+		// (-PRIORITY, SEQUENCE) -> TASK; HIGHER PRIORITY AND OLDER ONE FIRST
+		std::map<std::pair<int, size_t>, std::function<void()>> queue_;
+		HashMap<std::string, int> priority_map_;
+		size_t sequence_;
+
+		size_t size_;
+		size_t capacity_;
+
+		// START TIMES OF THE RUNNING TASKS, FOR EACH WORKER
+		std::map<std::thread::id, std::chrono::steady_clock::time_point> starts_;
+
+		// BUSY TIME SINCE THE LAST SAMPLE
+		std::chrono::steady_clock::duration busy_time_;
+		std::chrono::steady_clock::time_point sampled_at_;
+
+		std::mutex mtx_;
+		bool stopped_;
+
+		// THE WORKERS; EACH POSTED TASK TAKES THE FIRST ONE OF THE QUEUE
+		library::ThreadPool workers_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Construct from number of workers and capacity of the queue.
+		 *
+		 * @param size Number of workers. Default is number of the hardware threads.
+		 * @param capacity Number of tasks waiting in the queue without saturation. Default is four times of the *size*.
+		 */
+		WorkerPool(size_t size = 0, size_t capacity = 0)
+		{
+			sequence_ = 0;
+			stopped_ = false;
+
+			busy_time_ = std::chrono::steady_clock::duration::zero();
+			sampled_at_ = std::chrono::steady_clock::now();
+
+			reserve(size, capacity);
+		};
+
+		/**
+		 * Destructor, stopping the workers.
+		 */
+		virtual ~WorkerPool()
+		{
+			stop();
+		};
+
+		/**
+		 * Change number of workers and capacity of the queue.
+		 *
+		 * Workers are created lazily, when the first task is posted. After that, number of workers can only grow.
+		 *
+		 * @param size Number of workers. Zero means number of the hardware threads.
+		 * @param capacity Number of tasks waiting in the queue without saturation. Zero means four times of the *size*.
+		 */
+		void reserve(size_t size, size_t capacity = 0)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			if (size == 0)
+				size = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+			if (capacity == 0)
+				capacity = size * 4;
+
+			workers_.reserve(size);
+
+			size_ = workers_.size();
+			capacity_ = capacity;
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get number of workers.
+		 */
+		auto size() const -> size_t
+		{
+			return size_;
+		};
+
+		/**
+		 * Get number of tasks waiting in the queue without saturation.
+		 */
+		auto capacity() const -> size_t
+		{
+			return capacity_;
+		};
+
+		/**
+		 * Get number of tasks waiting in the queue.
+		 */
+		auto pending() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return queue_.size();
+		};
+
+		/**
+		 * Get number of tasks running.
+		 */
+		auto running() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return starts_.size();
+		};
+
+		/**
+		 * Test whether tasks waiting in the queue exceed the {@link capacity}.
+		 */
+		auto isSaturated() -> bool
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return queue_.size() > capacity_;
+		};
+
+		/**
+		 * Get priority of a process.
+		 *
+		 * @param name Name of the process.
+		 * @return The priority, default is zero.
+		 */
+		auto getPriority(const std::string &name) -> int
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = priority_map_.find(name);
+			return (it == priority_map_.end()) ? 0 : it->second;
+		};
+
+		/**
+		 * Set priority of a process.
+		 *
+		 * Tasks of a process with higher priority are executed earlier.
+		 *
+		 * @param name Name of the process; ```_Process_name``` of a distributed process or listener of a parallel one.
+		 * @param val The priority, default is zero.
+		 */
+		void setPriority(const std::string &name, int val)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			priority_map_.set(name, val);
+		};
+
+		/**
+		 * Compute utilization.
+		 *
+		 * Computes ratio of busy time of the workers, from the last computation to now.
+		 *
+		 * @return The utilization, in [0, 1].
+		 */
+		auto computeUtilization() -> double
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			std::chrono::steady_clock::duration busy = busy_time_;
+
+			// INCLUDE THE RUNNING ONES
+			for (auto it = starts_.begin(); it != starts_.end(); it++)
+				busy += now - std::max(it->second, sampled_at_);
+
+			double elapsed = (double)(now - sampled_at_).count() * size_;
+
+			busy_time_ = std::chrono::steady_clock::duration::zero();
+			sampled_at_ = now;
+
+			if (elapsed <= 0.0)
+				return 0.0;
+			else
+				return std::min<double>(busy.count() / elapsed, 1.0);
+		};
+
+		/**
+		 * Get backlog.
+		 *
+		 * @return A {@link Backlog} with the {@link computeUtilization utilization} from the last computation.
+		 */
+		auto getBacklog() -> Backlog
+		{
+			double utilization = computeUtilization();
+
+			std::unique_lock<std::mutex> uk(mtx_);
+			return Backlog(size_, queue_.size(), starts_.size(), utilization);
+		};
+
+		/* ---------------------------------------------------------
+			EXECUTION
+		--------------------------------------------------------- */
+		/**
+		 * Post a task.
+		 *
+		 * Enqueues the *task* with priority of the process and returns immediately, even if the queue is over the 
+		 * {@link capacity}. If the pool has been {@link stop stopped}, the *task* is discarded.
+		 *
+		 * @param name Name of the process, determining priority.
+		 * @param task A task to execute.
+		 * @return Whether the *task* is enqueued.
+		 */
+		auto post(const std::string &name, std::function<void()> task) -> bool
+		{
+			{
+				std::unique_lock<std::mutex> uk(mtx_);
+				if (stopped_ == true)
+					return false;
+
+				auto it = priority_map_.find(name);
+				int priority = (it == priority_map_.end()) ? 0 : it->second;
+
+				queue_.emplace(std::make_pair(-priority, sequence_++), move(task));
+			}
+
+			// A WORKER WILL TAKE THE FIRST TASK IN ORDER OF PRIORITY, NOT NECESSARILY THIS ONE
+			return workers_.post(std::bind(&WorkerPool::execute, this));
+		};
+
+		/**
+		 * Stop the workers.
+		 *
+		 * Waits for the tasks on execution to complete. Tasks waiting in the queue are discarded and tasks posted
+		 * after the stop are not accepted.
+		 */
+		void stop()
+		{
+			{
+				std::unique_lock<std::mutex> uk(mtx_);
+
+				stopped_ = true;
+				queue_.clear();
+			}
+			workers_.stop();
+		};
+
+	private:
+		void execute()
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			if (stopped_ == true || queue_.empty() == true)
+				return;
+
+			std::function<void()> task = move(queue_.begin()->second);
+			queue_.erase(queue_.begin());
+
+			std::thread::id id = std::this_thread::get_id();
+			starts_[id] = std::chrono::steady_clock::now();
+
+			uk.unlock();
+			try
+			{
+				task();
+			}
+			catch (...) {}
+			uk.lock();
+
+			// ACCUMULATE BUSY TIME
+			busy_time_ += std::chrono::steady_clock::now() - std::max(starts_[id], sampled_at_);
+			starts_.erase(id);
+		};
+	};
+};
+};
+};
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <samchon/templates/tracing/Tracer.hpp>
+#include <samchon/templates/tracing/SpanArray.hpp>
+#include <samchon/templates/tracing/Span.hpp>
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/Entity.hpp>
+
+#include <chrono>
+#include <algorithm>
+
+namespace samchon
+{
+namespace templates
+{
+namespace tracing
+{
+	/**
+	 * A span of a traced process.
+	 *
+	 * The {@link Span} is an interval of time spent on a step of a *parallel or distributed process*, identified by the
+	 * ```_History_uid```; dispatching in the master, transfer on the wire, waiting in the queue of a slave, handling
+	 * in a slave and reporting back to the master.
+	 *
+	 * Times are microseconds since epoch of the system clock, of the system which has recorded the span. Spans
+	 * reported by the slaves are shifted to the master's clock by the {@link Tracer}.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class Span
+		: public protocol::Entity<>
+	{
+	private:
+		typedef protocol::Entity<> super;
+
+		std::string name_;
+		std::string process_;
+		size_t uid_{ 0 };
+
+		long long start_{ 0 };
+		long long duration_{ 0 };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor.
+		 */
+		Span() : super()
+		{
+		};
+
+		/**
+		 * Initializer Constructor.
+		 *
+		 * @param name Name of the step.
+		 * @param process Name of the system where the step has run. Empty string means the recorder itself.
+		 * @param uid Unique ID of the process.
+		 * @param start Start time.
+		 * @param end End time.
+		 */
+		Span(const std::string &name, const std::string &process, size_t uid, std::chrono::system_clock::time_point start, std::chrono::system_clock::time_point end)
+			: super()
+		{
+			name_ = name;
+			process_ = process;
+			uid_ = uid;
+
+			start_ = _Micro(start);
+			duration_ = std::max<long long>(_Micro(end) - start_, 0);
+		};
+		virtual ~Span() = default;
+
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			name_ = xml->getProperty<std::string>("name");
+			process_ = xml->hasProperty("process") ? xml->getProperty<std::string>("process") : "";
+			uid_ = xml->getProperty<size_t>("uid");
+
+			start_ = xml->getProperty<long long>("start");
+			duration_ = xml->getProperty<long long>("duration");
+		};
+
+		/**
+		 * @hidden
+		 */
+		static auto _Micro(std::chrono::system_clock::time_point time) -> long long
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		auto getName() const -> std::string
+		{
+			return name_;
+		};
+
+		/**
+		 * Get name of the system where the step has run.
+		 */
+		auto getProcess() const -> std::string
+		{
+			return process_;
+		};
+		auto getUID() const -> size_t
+		{
+			return uid_;
+		};
+
+		/**
+		 * Get start time, in microseconds.
+		 */
+		auto getStart() const -> long long
+		{
+			return start_;
+		};
+
+		/**
+		 * Get duration, in microseconds.
+		 */
+		auto getDuration() const -> long long
+		{
+			return duration_;
+		};
+
+		void setProcess(const std::string &val)
+		{
+			process_ = val;
+		};
+
+		/**
+		 * Shift the start time, to another clock.
+		 *
+		 * @param offset Microseconds to subtract.
+		 */
+		void shift(long long offset)
+		{
+			start_ -= offset;
+		};
+
+		/* ---------------------------------------------------------
+			EXPORTERS
+		--------------------------------------------------------- */
+		virtual auto TAG() const -> std::string override
+		{
+			return "span";
+		};
+
+		virtual auto toXML() const -> std::shared_ptr<library::XML> override
+		{
+			std::shared_ptr<library::XML> xml = super::toXML();
+			xml->setProperty("name", name_);
+			if (process_.empty() == false)
+				xml->setProperty("process", process_);
+			xml->setProperty("uid", uid_);
+
+			xml->setProperty("start", start_);
+			xml->setProperty("duration", duration_);
+
+			return xml;
+		};
+	};
+};
+};
+};
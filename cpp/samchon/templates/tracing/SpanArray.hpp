@@ -0,0 +1,105 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/protocol/SharedEntityArray.hpp>
+#include <samchon/templates/tracing/Span.hpp>
+
+namespace samchon
+{
+namespace templates
+{
+namespace tracing
+{
+	/**
+	 * Spans recorded by a slave.
+	 *
+	 * The {@link SpanArray} is piggybacked on a report of history as the ```_Trace``` parameter. With the
+	 * {@link Span spans}, it carries time the request was {@link getReceived received} and time the report was
+	 * {@link getSent sent}, in the slave's clock. Paired with time of sending and receiving in the master's clock, the
+	 * {@link Tracer} estimates offset between the clocks, as NTP does.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class SpanArray
+		: public protocol::SharedEntityArray<Span>
+	{
+	private:
+		typedef protocol::SharedEntityArray<Span> super;
+
+		long long received_{ 0 };
+		long long sent_{ 0 };
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		using super::super;
+		virtual ~SpanArray() = default;
+
+		virtual void construct(std::shared_ptr<library::XML> xml) override
+		{
+			received_ = xml->getProperty<long long>("received");
+			sent_ = xml->getProperty<long long>("sent");
+
+			super::construct(xml);
+		};
+
+	protected:
+		virtual auto createChild(std::shared_ptr<library::XML>) -> Span* override
+		{
+			return new Span();
+		};
+
+	public:
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get time the request was received, in microseconds.
+		 */
+		auto getReceived() const -> long long
+		{
+			return received_;
+		};
+
+		/**
+		 * Get time the report was sent, in microseconds.
+		 */
+		auto getSent() const -> long long
+		{
+			return sent_;
+		};
+
+		void setReceived(std::chrono::system_clock::time_point val)
+		{
+			received_ = Span::_Micro(val);
+		};
+		void setSent(std::chrono::system_clock::time_point val)
+		{
+			sent_ = Span::_Micro(val);
+		};
+
+		/* ---------------------------------------------------------
+			EXPORTERS
+		--------------------------------------------------------- */
+		virtual auto TAG() const -> std::string override
+		{
+			return "trace";
+		};
+		virtual auto CHILD_TAG() const -> std::string override
+		{
+			return "span";
+		};
+
+		virtual auto toXML() const -> std::shared_ptr<library::XML> override
+		{
+			std::shared_ptr<library::XML> xml = super::toXML();
+			xml->setProperty("received", received_);
+			xml->setProperty("sent", sent_);
+
+			return xml;
+		};
+	};
+};
+};
+};
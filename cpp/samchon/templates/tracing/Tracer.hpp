@@ -0,0 +1,368 @@
+#pragma once
+#include <samchon/API.hpp>
+
+#include <samchon/templates/tracing/SpanArray.hpp>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <sstream>
+#include <fstream>
+#include <stdexcept>
+#include <cstdio>
+
+namespace samchon
+{
+namespace templates
+{
+namespace tracing
+{
+	/**
+	 * A collector of spans, in a master.
+	 *
+	 * The {@link Tracer} of a {@link ParallelSystemArray} traces *parallel and distributed processes* step by step.
+	 * When {@link setEnabled enabled}, requests are sent with the ```_Trace``` parameter, then slaves record their
+	 * {@link Span spans} locally and piggyback them on the reports. The {@link Tracer} merges them with its own spans
+	 * and exports them in {@link toJSON Chrome trace format}, to be viewed in ```chrome://tracing``` or Perfetto.
+	 *
+	 * Spans of a process, by its ```_History_uid```:
+	 * - ```dispatch```: partitioning, serializing and enqueueing in the master.
+	 * - ```wire```: from enqueueing in the master to receiving in the slave.
+	 * - ```queue```: waiting for a worker in the slave.
+	 * - ```handler```: handling in the slave, from start to end of the {@link PInvoke}.
+	 * - ```report```: from sending the report in the slave to receiving in the master.
+	 * - ```mediate```: from receiving to reporting in a {@link MediatorSystem}, whose own slaves' spans are nested in
+	 *	 the name of the mediator, like ```mediator/slave```.
+	 *
+	 * Clocks of the slaves are corrected to the master's, by offsets estimated from the reports and the
+	 * {@link ClockEstimator pings} as NTP does: the sample having the least round trip delay wins, aging slowly to
+	 * follow drifts.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class Tracer
+	{
+	private:
+		std::string name_;
+		std::atomic<bool> enabled_{ false };
+		size_t capacity_;
+
+		// SPANS BY UID; THE OLDEST PROCESSES ARE DROPPED BEYOND THE CAPACITY
+		std::map<size_t, std::vector<std::shared_ptr<Span>>> spans_;
+
+		// CLOCK OFFSETS BY PROCESS; (ROUND TRIP DELAY, OFFSET) OF THE BEST SAMPLE
+		std::unordered_map<std::string, std::pair<double, long long>> offsets_;
+
+		mutable std::mutex mtx_;
+
+	public:
+		/* ---------------------------------------------------------
+			CONSTRUCTORS
+		--------------------------------------------------------- */
+		/**
+		 * Default Constructor.
+		 */
+		Tracer()
+		{
+			name_ = "master";
+			capacity_ = 65536;
+		};
+
+		/* ---------------------------------------------------------
+			ACCESSORS
+		--------------------------------------------------------- */
+		/**
+		 * Get name of the master, for its own spans.
+		 */
+		auto getName() const -> std::string
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return name_;
+		};
+		void setName(const std::string &val)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			name_ = val;
+		};
+
+		auto isEnabled() const -> bool
+		{
+			return enabled_;
+		};
+
+		/**
+		 * Enable or disable tracing.
+		 *
+		 * Only requests sent while enabled are traced.
+		 */
+		void setEnabled(bool val)
+		{
+			enabled_ = val;
+		};
+
+		/**
+		 * Get capacity, maximum number of processes to keep spans.
+		 */
+		auto getCapacity() const -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			return capacity_;
+		};
+		void setCapacity(size_t val)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			capacity_ = val;
+
+			while (spans_.size() > capacity_)
+				spans_.erase(spans_.begin());
+		};
+
+		/**
+		 * Get estimated offset of a slave's clock.
+		 *
+		 * @param process Name of the slave system.
+		 * @return Microseconds the slave's clock is ahead of the master's.
+		 */
+		auto getOffset(const std::string &process) const -> long long
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = offsets_.find(process);
+			return (it == offsets_.end()) ? 0 : it->second.second;
+		};
+
+		/* ---------------------------------------------------------
+			RECORDERS
+		--------------------------------------------------------- */
+		/**
+		 * Record a span of the master itself.
+		 *
+		 * @param name Name of the step.
+		 * @param uid Unique ID of the process.
+		 * @param start Start time.
+		 * @param end End time.
+		 */
+		void record(const std::string &name, size_t uid, std::chrono::system_clock::time_point start, std::chrono::system_clock::time_point end)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			_Insert(std::make_shared<Span>(name, name_, uid, start, end));
+		};
+
+		/**
+		 * Collect spans reported by a slave.
+		 *
+		 * Estimates offset of the slave's clock, shifts the spans to the master's clock and derives spans of the wire
+		 * and the report.
+		 *
+		 * @param process Name of the slave system.
+		 * @param uid Unique ID of the process.
+		 * @param sent Time the master has sent the request.
+		 * @param received Time the master has received the report.
+		 * @param trace Spans reported by the slave.
+		 */
+		void _Collect(const std::string &process, size_t uid, std::chrono::system_clock::time_point sent, std::chrono::system_clock::time_point received, const SpanArray &trace)
+		{
+			long long t0 = Span::_Micro(sent);
+			long long t3 = Span::_Micro(received);
+			long long t1 = trace.getReceived();
+			long long t2 = trace.getSent();
+
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			long long delay = std::max<long long>((t3 - t0) - (t2 - t1), 0);
+			long long offset = _Sample(process, delay, ((t1 - t0) + (t2 - t3)) / 2);
+
+			// SPANS OF THE SLAVE, IN THE MASTER'S CLOCK. NESTED ONES ARE PREFIXED BY THE SLAVE
+			for (size_t i = 0; i < trace.size(); i++)
+			{
+				std::shared_ptr<Span> span(new Span(*trace.at(i)));
+				span->shift(offset);
+				span->setProcess(span->getProcess().empty() ? process : process + "/" + span->getProcess());
+
+				_Insert(span);
+			}
+
+			// THE WIRE AND THE REPORT
+			std::chrono::system_clock::time_point arrival = sent + std::chrono::microseconds(std::max<long long>(t1 - offset, t0) - t0);
+			std::chrono::system_clock::time_point departure = received - std::chrono::microseconds(t3 - std::min<long long>(t2 - offset, t3));
+
+			_Insert(std::make_shared<Span>("wire", process, uid, sent, arrival));
+			_Insert(std::make_shared<Span>("report", process, uid, departure, received));
+		};
+
+		/**
+		 * Observe offset of a slave's clock, estimated by others.
+		 *
+		 * Samples from {@link ClockEstimator pings} compete with the ones from the reports; the least delayed wins.
+		 *
+		 * @param process Name of the slave system.
+		 * @param delay Round trip delay of the sample, in microseconds.
+		 * @param offset Microseconds the slave's clock is ahead of the master's.
+		 */
+		void _Observe_offset(const std::string &process, long long delay, long long offset)
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			_Sample(process, delay, offset);
+		};
+
+		/**
+		 * Take spans of a process, to be reported to the upper master.
+		 *
+		 * Used by a {@link MediatorSystem}. Own spans are unnamed, to be named after the mediator by the upper master.
+		 *
+		 * @param uid Unique ID of the process.
+		 * @return Spans of the process.
+		 */
+		auto _Take(size_t uid) -> std::shared_ptr<SpanArray>
+		{
+			std::shared_ptr<SpanArray> trace(new SpanArray());
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			auto it = spans_.find(uid);
+			if (it == spans_.end())
+				return trace;
+
+			for (size_t i = 0; i < it->second.size(); i++)
+			{
+				std::shared_ptr<Span> &span = it->second[i];
+				if (span->getProcess() == name_)
+					span->setProcess("");
+
+				trace->push_back(span);
+			}
+			spans_.erase(it);
+
+			return trace;
+		};
+
+		/**
+		 * Clear all the spans.
+		 */
+		void clear()
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+			spans_.clear();
+		};
+
+	private:
+		auto _Sample(const std::string &process, long long delay, long long offset) -> long long
+		{
+			// OFFSET OF THE LEAST DELAYED SAMPLE, AGING TO FOLLOW DRIFTS
+			auto it = offsets_.find(process);
+			if (it == offsets_.end())
+				it = offsets_.emplace(process, std::make_pair((double)delay, offset)).first;
+			else if ((double)delay <= it->second.first)
+				it->second = std::make_pair((double)delay, offset);
+			else
+				it->second.first = it->second.first * 1.01 + 1.0;
+
+			return it->second.second;
+		};
+
+		void _Insert(std::shared_ptr<Span> span)
+		{
+			spans_[span->getUID()].push_back(span);
+
+			while (spans_.size() > capacity_)
+				spans_.erase(spans_.begin());
+		};
+
+	public:
+		/* ---------------------------------------------------------
+			EXPORTERS
+		--------------------------------------------------------- */
+		/**
+		 * Export the spans in Chrome trace format.
+		 *
+		 * Each system is a process and each ```_History_uid``` is a thread of the trace.
+		 *
+		 * @return A JSON string.
+		 */
+		auto toJSON() const -> std::string
+		{
+			std::unique_lock<std::mutex> uk(mtx_);
+
+			std::unordered_map<std::string, size_t> pids;
+			std::vector<std::string> processes;
+
+			std::stringstream events;
+			for (auto it = spans_.begin(); it != spans_.end(); it++)
+				for (size_t i = 0; i < it->second.size(); i++)
+				{
+					const std::shared_ptr<Span> &span = it->second[i];
+
+					auto pid_it = pids.find(span->getProcess());
+					if (pid_it == pids.end())
+					{
+						pid_it = pids.emplace(span->getProcess(), processes.size() + 1).first;
+						processes.push_back(span->getProcess());
+					}
+
+					events << ",\n"
+						<< "{\"name\":\"" << escape(span->getName()) << "\",\"cat\":\"samchon\",\"ph\":\"X\""
+						<< ",\"ts\":" << span->getStart() << ",\"dur\":" << span->getDuration()
+						<< ",\"pid\":" << pid_it->second << ",\"tid\":" << span->getUID()
+						<< ",\"args\":{\"uid\":" << span->getUID() << "}}";
+				}
+
+			// NAMES OF THE PROCESSES, AHEAD OF THE SPANS
+			std::stringstream ss;
+			ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+			for (size_t i = 0; i < processes.size(); i++)
+			{
+				if (i != 0)
+					ss << ",";
+				ss << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << (i + 1)
+					<< ",\"args\":{\"name\":\"" << escape(processes[i]) << "\"}}";
+			}
+
+			ss << events.str() << "\n]}";
+
+			return ss.str();
+		};
+
+		/**
+		 * Save the spans as a Chrome trace file.
+		 *
+		 * @param path Path of the file.
+		 */
+		void save(const std::string &path) const
+		{
+			std::ofstream file(path, std::ios::out | std::ios::trunc);
+			if (file.is_open() == false)
+				throw std::runtime_error("unable to open the trace file: " + path);
+
+			file << toJSON();
+		};
+
+	private:
+		static auto escape(const std::string &str) -> std::string
+		{
+			std::string ret;
+			ret.reserve(str.size());
+
+			for (size_t i = 0; i < str.size(); i++)
+			{
+				char ch = str[i];
+				if (ch == '"' || ch == '\\')
+				{
+					ret += '\\';
+					ret += ch;
+				}
+				else if ((unsigned char)ch < 0x20)
+				{
+					char buffer[8];
+					snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned char)ch);
+					ret += buffer;
+				}
+				else
+					ret += ch;
+			}
+			return ret;
+		};
+	};
+};
+};
+};